@@ -0,0 +1,165 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "AttributeComponent.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+
+UAttributeComponent::UAttributeComponent()
+{
+    PrimaryComponentTick.bCanEverTick = false;
+}
+
+float UAttributeComponent::GetValue(EAttribute Attribute) const
+{
+    const int32 Index = (int32)Attribute;
+    if ((DirtyMask & Bit(Attribute)) != 0)
+    {
+        const FStat& Stat = Stats[Index];
+        const float Multiplier = Stat.ZeroMultipliers > 0 ? 0.0f : Stat.Multiplier;
+        Values[Index] = (Stat.Base + Stat.Flat) * (1.0f + Stat.Additive) * Multiplier;
+        DirtyMask &= ~Bit(Attribute);
+    }
+    return Values[Index];
+}
+
+void UAttributeComponent::SetValue(EAttribute Attribute, float NewBaseValue)
+{
+    SetBase(Attribute, NewBaseValue, false);
+}
+
+void UAttributeComponent::ResetValue(EAttribute Attribute, float NewBaseValue)
+{
+    SetBase(Attribute, NewBaseValue, true);
+}
+
+void UAttributeComponent::SetBase(EAttribute Attribute, float NewBaseValue, bool bReset)
+{
+    if (Attribute >= EAttribute::Count)
+        return;
+
+    Stats[(int32)Attribute].Base = NewBaseValue;
+    DirtyMask |= Bit(Attribute);
+
+    // Damage has to land (and possibly kill) right away, so base writes don't wait for the flush
+    Publish(Attribute, bReset);
+}
+
+void UAttributeComponent::AddModifier(FName Source, EAttribute Attribute, EAttributeModOp Op, float Magnitude)
+{
+    if (Attribute >= EAttribute::Count)
+        return;
+
+    const FAttributeModifier Modifier{ Attribute, Op, Magnitude };
+    TArray<FAttributeModifier, TInlineAllocator<2>>& Modifiers = ModifiersBySource.FindOrAdd(Source);
+
+    FAttributeModifier* Existing = Modifiers.FindByPredicate([&](const FAttributeModifier& Other)
+    {
+        return Other.Attribute == Attribute && Other.Op == Op;
+    });
+
+    if (Existing)
+    {
+        Accumulate(*Existing, -1);
+        *Existing = Modifier;
+    }
+    else
+    {
+        Modifiers.Add(Modifier);
+    }
+
+    Accumulate(Modifier, 1);
+    ScheduleFlush();
+}
+
+void UAttributeComponent::RemoveModifiers(FName Source)
+{
+    TArray<FAttributeModifier, TInlineAllocator<2>> Removed;
+    if (!ModifiersBySource.RemoveAndCopyValue(Source, Removed))
+        return;
+
+    for (const FAttributeModifier& Modifier : Removed)
+    {
+        Accumulate(Modifier, -1);
+    }
+    ScheduleFlush();
+}
+
+void UAttributeComponent::Accumulate(const FAttributeModifier& Modifier, int32 Sign)
+{
+    FStat& Stat = Stats[(int32)Modifier.Attribute];
+
+    switch (Modifier.Op)
+    {
+    case EAttributeModOp::Flat:
+        Stat.Flat += Sign * Modifier.Magnitude;
+        break;
+
+    case EAttributeModOp::Additive:
+        Stat.Additive += Sign * Modifier.Magnitude;
+        break;
+
+    case EAttributeModOp::Multiplicative:
+        if (Modifier.Magnitude == 0.0f)
+        {
+            Stat.ZeroMultipliers += Sign;
+        }
+        else
+        {
+            Stat.Multiplier = Sign > 0 ? Stat.Multiplier * Modifier.Magnitude : Stat.Multiplier / Modifier.Magnitude;
+        }
+        break;
+    }
+
+    DirtyMask |= Bit(Modifier.Attribute);
+    PendingMask |= Bit(Modifier.Attribute);
+}
+
+void UAttributeComponent::ScheduleFlush()
+{
+    if (bFlushScheduled)
+        return;
+
+    if (UWorld* World = GetWorld())
+    {
+        bFlushScheduled = true;
+        World->GetTimerManager().SetTimerForNextTick(this, &UAttributeComponent::FlushChanges);
+    }
+    else
+    {
+        FlushChanges();
+    }
+}
+
+void UAttributeComponent::FlushChanges()
+{
+    bFlushScheduled = false;
+
+    // Several equips in one frame end up as at most one event per attribute
+    const uint8 Pending = PendingMask;
+    PendingMask = 0;
+
+    for (int32 Index = 0; Index < (int32)EAttribute::Count; ++Index)
+    {
+        if ((Pending & Bit((EAttribute)Index)) != 0)
+        {
+            Publish((EAttribute)Index, false);
+        }
+    }
+}
+
+void UAttributeComponent::Publish(EAttribute Attribute, bool bReset)
+{
+    const int32 Index = (int32)Attribute;
+    const float NewValue = GetValue(Attribute);
+    if (PublishedValues[Index] == NewValue)
+        return;
+
+    FAttributeChange Change;
+    Change.Attribute = Attribute;
+    Change.OldValue = PublishedValues[Index];
+    Change.NewValue = NewValue;
+    Change.bReset = bReset;
+
+    PublishedValues[Index] = NewValue;
+    OnAttributeChanged.Broadcast(Change);
+}
@@ -0,0 +1,139 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "AttributeComponent.generated.h"
+
+UENUM(BlueprintType)
+enum class EAttribute : uint8
+{
+    Health,
+    Defense,
+    Attack,
+    MoveSpeed,
+
+    Count UMETA(Hidden)
+};
+
+// Final = (Base + sum of Flat) * (1 + sum of Additive) * product of Multiplicative
+UENUM(BlueprintType)
+enum class EAttributeModOp : uint8
+{
+    Flat,
+    Additive,
+    Multiplicative
+};
+
+struct FAttributeModifier
+{
+    EAttribute Attribute = EAttribute::Health;
+    EAttributeModOp Op = EAttributeModOp::Flat;
+    float Magnitude = 0.0f;
+};
+
+struct FAttributeChange
+{
+    EAttribute Attribute = EAttribute::Health;
+    float OldValue = 0.0f;
+    float NewValue = 0.0f;
+
+    // Set by ResetValue (spawn, save load): refresh displays, but it is not damage / healing
+    bool bReset = false;
+};
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnAttributeChanged, const FAttributeChange& /*Change*/);
+
+/**
+ * Health, defense, attack and move speed for a Paper actor.
+ * Each attribute is a base value plus modifiers (equipment, consumables, buffs) registered under a
+ * source name. Adding or removing a modifier only adjusts that attribute's running sums and sets
+ * its dirty bit; the final value is recomputed when it is next read. Base value writes publish
+ * immediately, modifier changes are published once on the next tick, and only values that really
+ * changed reach OnAttributeChanged, so the HUD, combat text and death handling never poll.
+ */
+UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
+class BRIDGEANDBLADE_API UAttributeComponent : public UActorComponent
+{
+    GENERATED_BODY()
+
+public:
+    UAttributeComponent();
+
+    // Final value, base and modifiers applied
+    UFUNCTION(BlueprintPure, Category = "Attributes")
+    float GetValue(EAttribute Attribute) const;
+
+    UFUNCTION(BlueprintPure, Category = "Attributes")
+    float GetBaseValue(EAttribute Attribute) const { return Stats[(int32)Attribute].Base; }
+
+    UFUNCTION(BlueprintPure, Category = "Attributes")
+    int32 GetHealth() const { return FMath::RoundToInt(GetValue(EAttribute::Health)); }
+
+    // Gameplay change of the base value (damage, healing, weapon swap); published immediately
+    UFUNCTION(BlueprintCallable, Category = "Attributes")
+    void SetValue(EAttribute Attribute, float NewBaseValue);
+
+    UFUNCTION(BlueprintCallable, Category = "Attributes")
+    void ApplyDelta(EAttribute Attribute, float Delta) { SetValue(Attribute, GetBaseValue(Attribute) + Delta); }
+
+    // Non-gameplay change of the base value (initial values, save load); broadcast with bReset set
+    void ResetValue(EAttribute Attribute, float NewBaseValue);
+
+    // Add a modifier under Source; replaces Source's existing modifier with the same attribute and op
+    UFUNCTION(BlueprintCallable, Category = "Attributes")
+    void AddModifier(FName Source, EAttribute Attribute, EAttributeModOp Op, float Magnitude);
+
+    // Remove everything Source contributed
+    UFUNCTION(BlueprintCallable, Category = "Attributes")
+    void RemoveModifiers(FName Source);
+
+    UFUNCTION(BlueprintPure, Category = "Attributes")
+    bool HasModifiers(FName Source) const { return ModifiersBySource.Contains(Source); }
+
+    // Publish pending modifier changes now instead of on the next tick
+    void FlushChanges();
+
+    FOnAttributeChanged OnAttributeChanged;
+
+private:
+    // Running sums for one attribute
+    struct FStat
+    {
+        float Base = 0.0f;
+        float Flat = 0.0f;
+        float Additive = 0.0f;
+
+        // Product of the non-zero multipliers, plus how many zero multipliers there are
+        float Multiplier = 1.0f;
+        int32 ZeroMultipliers = 0;
+    };
+
+    static uint8 Bit(EAttribute Attribute) { return (uint8)(1u << (uint8)Attribute); }
+
+    // Add (Sign = 1) or take back (Sign = -1) one modifier's contribution
+    void Accumulate(const FAttributeModifier& Modifier, int32 Sign);
+
+    void SetBase(EAttribute Attribute, float NewBaseValue, bool bReset);
+
+    // Broadcast Attribute if its final value differs from what was last published
+    void Publish(EAttribute Attribute, bool bReset);
+
+    void ScheduleFlush();
+
+    FStat Stats[(int32)EAttribute::Count];
+
+    // Cached final values, valid unless the attribute's dirty bit is set
+    mutable float Values[(int32)EAttribute::Count] = {};
+    mutable uint8 DirtyMask = 0;
+
+    // Values as subscribers last saw them
+    float PublishedValues[(int32)EAttribute::Count] = {};
+
+    // Attributes with modifier changes waiting for the next flush
+    uint8 PendingMask = 0;
+    bool bFlushScheduled = false;
+
+    TMap<FName, TArray<FAttributeModifier, TInlineAllocator<2>>> ModifiersBySource;
+};
@@ -1,6 +1,19 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "BridgeAndBlade.h"
+#include "ItemCatalogCommandlet.h"
 #include "Modules/ModuleManager.h"
 
-IMPLEMENT_PRIMARY_GAME_MODULE( FDefaultGameModuleImpl, BridgeAndBlade, "BridgeAndBlade" );
+class FBridgeAndBladeModule : public FDefaultGameModuleImpl
+{
+public:
+    virtual void StartupModule() override
+    {
+#if WITH_EDITOR
+        // Keep Content/Data/ItemCatalog.bin in step with DT_Items in every cook
+        UItemCatalogCommandlet::RegisterCookHook();
+#endif
+    }
+};
+
+IMPLEMENT_PRIMARY_GAME_MODULE( FBridgeAndBladeModule, BridgeAndBlade, "BridgeAndBlade" );
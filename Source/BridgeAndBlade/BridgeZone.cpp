@@ -7,10 +7,14 @@
 #include "BridgePromptWidget.h"
 #include "Kismet/GameplayStatics.h"
 #include "SaveGameManager.h"
+#include "IslandPreloadSubsystem.h"
+#include "IslandStreamingSubsystem.h"
+#include "Engine/LevelStreaming.h"
 
 ABridgeZone::ABridgeZone()
 {
-    PrimaryActorTick.bCanEverTick = true;
+    // Everything here is overlap / UI driven
+    PrimaryActorTick.bCanEverTick = false;
 
     // Create root
     RootScene = CreateDefaultSubobject<USceneComponent>(TEXT("RootScene"));
@@ -29,6 +33,18 @@ ABridgeZone::ABridgeZone()
     BridgeMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 	BridgeMesh->SetRelativeLocation(FVector(5000.f, 0.f, -50.f));
 
+    // Move to the far end of the bridge mesh in the Blueprint
+    ArrivalVolume = CreateDefaultSubobject<UBoxComponent>(TEXT("ArrivalVolume"));
+    ArrivalVolume->SetupAttachment(RootComponent);
+    ArrivalVolume->SetBoxExtent(FVector(200.f, 200.f, 100.f));
+    ArrivalVolume->SetCollisionProfileName(TEXT("Trigger"));
+    ArrivalVolume->SetRelativeLocation(FVector(10000.f, 0.f, 0.f));
+
+    PreloadVolume = CreateDefaultSubobject<USphereComponent>(TEXT("PreloadVolume"));
+    PreloadVolume->SetupAttachment(RootComponent);
+    PreloadVolume->SetSphereRadius(PreloadRadius);
+    PreloadVolume->SetCollisionProfileName(TEXT("Trigger"));
+
     // Default state
     BridgeState = EBridgeZoneState::NeedsToBuild;
     bPlayerInZone = false;
@@ -44,29 +60,37 @@ void ABridgeZone::BeginPlay()
     // Bind trigger events
     TriggerVolume->OnComponentBeginOverlap.AddDynamic(this, &ABridgeZone::OnTriggerBeginOverlap);
     TriggerVolume->OnComponentEndOverlap.AddDynamic(this, &ABridgeZone::OnTriggerEndOverlap);
+    ArrivalVolume->OnComponentBeginOverlap.AddDynamic(this, &ABridgeZone::OnArrivalBeginOverlap);
+    PreloadVolume->OnComponentBeginOverlap.AddDynamic(this, &ABridgeZone::OnPreloadBeginOverlap);
+    PreloadVolume->OnComponentEndOverlap.AddDynamic(this, &ABridgeZone::OnPreloadEndOverlap);
 
-    // Check save data to see if this bridge was already built
-    USaveGameManager* SaveManager = USaveGameManager::Get(this);
-    if (SaveManager && SaveManager->IsBridgeBuilt(BridgeID))
-    {
-        // Bridge was previously built, restore its state
-        BridgeState = EBridgeZoneState::BuiltCanTravel;
-        BridgeMesh->SetVisibility(true);
-        BridgeMesh->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
-        
-        UE_LOG(LogTemp, Log, TEXT("Bridge %s restored from save as built"), *BridgeID.ToString());
-    }
-    else
+    // Instances may override the radius; the player may also spawn already inside it
+    PreloadVolume->SetSphereRadius(PreloadRadius);
+
+    // Bridge not built yet
+    BridgeMesh->SetVisibility(false);
+    BridgeMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+
+    // The save may still be loading; check now and again once it has been applied
+    if (USaveGameManager* SaveManager = USaveGameManager::Get(this))
     {
-        // Bridge not built yet
-        BridgeMesh->SetVisibility(false);
-        BridgeMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+        SaveManager->OnSaveApplied.AddUObject(this, &ABridgeZone::RestoreFromSave);
     }
+    RestoreFromSave();
 }
 
-void ABridgeZone::Tick(float DeltaTime)
+void ABridgeZone::RestoreFromSave()
 {
-    Super::Tick(DeltaTime);
+    USaveGameManager* SaveManager = USaveGameManager::Get(this);
+    if (BridgeState == EBridgeZoneState::BuiltCanTravel || !SaveManager || !SaveManager->IsBridgeBuilt(BridgeID))
+        return;
+
+    // Bridge was previously built, restore its state
+    BridgeState = EBridgeZoneState::BuiltCanTravel;
+    BridgeMesh->SetVisibility(true);
+    BridgeMesh->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+
+    UE_LOG(LogTemp, Log, TEXT("Bridge %s restored from save as built"), *BridgeID.ToString());
 }
 
 void ABridgeZone::OnTriggerBeginOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
@@ -79,6 +103,9 @@ void ABridgeZone::OnTriggerBeginOverlap(UPrimitiveComponent* OverlappedComponent
         bPlayerInZone = true;
         ShowPrompt();
 
+        // Usually already running from the approach; covers a zero radius or a bridge built meanwhile
+        PreloadDestination();
+
         UE_LOG(LogTemp, Log, TEXT("Player entered bridge zone"));
     }
 }
@@ -225,20 +252,150 @@ void ABridgeZone::TravelToNextIsland()
         return;
     }
 
-    // Save the game before traveling
+    if (bTravelPending)
+        return;
+
+    // Same world: stream the island in and let the player walk across; the far end finishes the trip
+    if (IsDestinationStreamed())
+    {
+        UIslandStreamingSubsystem::Get(this)->StreamIn(DestinationLevelName);
+        UE_LOG(LogTemp, Log, TEXT("Streaming in %s, cross the bridge to travel"), *DestinationLevelName.ToString());
+        return;
+    }
+
+    // The next level takes the player's state from memory; the save is written alongside and nothing waits on it
     APaperChar* Player = Cast<APaperChar>(UGameplayStatics::GetPlayerCharacter(this, 0));
-    if (Player)
+    USaveGameManager* SaveManager = USaveGameManager::Get(this);
+    if (Player && SaveManager)
     {
-        USaveGameManager* SaveManager = USaveGameManager::Get(this);
-        if (SaveManager)
-        {
-            SaveManager->SaveGame(Player);
-            UE_LOG(LogTemp, Log, TEXT("Game auto-saved before level transition"));
-        }
+        SaveManager->CarryPlayerState(Player, DestinationLevelName, TEXT("PlayerSaveSlot"));
     }
 
+    OpenDestinationLevel();
+}
+
+void ABridgeZone::OpenDestinationLevel()
+{
+    bTravelPending = true;
+
     UE_LOG(LogTemp, Log, TEXT("Traveling to level: %s"), *DestinationLevelName.ToString());
 
+    if (UIslandPreloadSubsystem* Preloader = UIslandPreloadSubsystem::Get(this))
+    {
+        Preloader->NotifyTravel(DestinationLevelName);
+    }
+
     // Load the next level
     UGameplayStatics::OpenLevel(this, DestinationLevelName);
+}
+
+void ABridgeZone::OnPreloadBeginOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
+    UPrimitiveComponent* OtherComp, int OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
+{
+    if (Cast<APaperChar>(OtherActor))
+    {
+        PreloadDestination();
+    }
+}
+
+void ABridgeZone::OnPreloadEndOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
+    UPrimitiveComponent* OtherComp, int OtherBodyIndex)
+{
+    // Leaving while travel is pending is the travel itself, not a turn back
+    if (!Cast<APaperChar>(OtherActor) || bTravelPending)
+        return;
+
+    // Out the far side onto a built bridge is heading across, not turning back
+    const FVector LocalPos = GetActorTransform().InverseTransformPosition(OtherActor->GetActorLocation());
+    if (BridgeState == EBridgeZoneState::BuiltCanTravel && LocalPos.X > 0.f)
+        return;
+
+    if (UIslandPreloadSubsystem* Preloader = UIslandPreloadSubsystem::Get(this))
+    {
+        Preloader->CancelIsland(DestinationLevelName);
+    }
+}
+
+void ABridgeZone::PreloadDestination()
+{
+    if (DestinationLevelName.IsNone())
+        return;
+
+    // A sublevel loads through streaming instead, so only a separate map needs its package
+    const bool bStreamed = IsDestinationStreamed();
+    if (UIslandPreloadSubsystem* Preloader = UIslandPreloadSubsystem::Get(this))
+    {
+        Preloader->PreloadIsland(DestinationLevelName, !bStreamed);
+    }
+
+    // A built bridge leads somewhere the player can see; bring the island itself in too
+    if (BridgeState == EBridgeZoneState::BuiltCanTravel && bStreamed)
+    {
+        UIslandStreamingSubsystem::Get(this)->StreamIn(DestinationLevelName);
+    }
+}
+
+bool ABridgeZone::IsDestinationStreamed() const
+{
+    const UIslandStreamingSubsystem* Streaming = UIslandStreamingSubsystem::Get(this);
+    return Streaming && Streaming->CanStream(DestinationLevelName);
+}
+
+void ABridgeZone::OnArrivalBeginOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
+    UPrimitiveComponent* OtherComp, int OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
+{
+    APaperChar* Player = Cast<APaperChar>(OtherActor);
+    if (!Player || BridgeState != EBridgeZoneState::BuiltCanTravel || !IsDestinationStreamed())
+        return;
+
+    UIslandStreamingSubsystem* Streaming = UIslandStreamingSubsystem::Get(this);
+    if (Streaming->GetCurrentIsland() == DestinationLevelName)
+        return;
+
+    if (Streaming->IsIslandVisible(DestinationLevelName))
+    {
+        CompleteStreamedCrossing(Player);
+        return;
+    }
+
+    // Walked faster than the island loaded; finish as soon as it shows up
+    Streaming->StreamIn(DestinationLevelName);
+    if (ULevelStreaming* StreamingLevel = Streaming->FindStreamingLevel(DestinationLevelName))
+    {
+        StreamingLevel->OnLevelShown.AddUniqueDynamic(this, &ABridgeZone::OnDestinationShown);
+    }
+}
+
+void ABridgeZone::OnDestinationShown()
+{
+    UIslandStreamingSubsystem* Streaming = UIslandStreamingSubsystem::Get(this);
+    if (ULevelStreaming* StreamingLevel = Streaming ? Streaming->FindStreamingLevel(DestinationLevelName) : nullptr)
+    {
+        StreamingLevel->OnLevelShown.RemoveDynamic(this, &ABridgeZone::OnDestinationShown);
+    }
+
+    APaperChar* Player = Cast<APaperChar>(UGameplayStatics::GetPlayerCharacter(this, 0));
+    if (Player && ArrivalVolume->IsOverlappingActor(Player))
+    {
+        CompleteStreamedCrossing(Player);
+    }
+}
+
+void ABridgeZone::CompleteStreamedCrossing(APaperChar* Player)
+{
+    UE_LOG(LogTemp, Log, TEXT("Crossed to streamed island: %s"), *DestinationLevelName.ToString());
+
+    if (UIslandPreloadSubsystem* Preloader = UIslandPreloadSubsystem::Get(this))
+    {
+        Preloader->NotifyTravel(DestinationLevelName);
+    }
+
+    // The player, inventory and subsystems stay as they are; only the islands swap
+    UIslandStreamingSubsystem::Get(this)->EnterIsland(DestinationLevelName);
+
+    // Same save as before an OpenLevel, but nothing waits on it
+    if (USaveGameManager* SaveManager = USaveGameManager::Get(this))
+    {
+        SaveManager->SaveGame(Player, TEXT("PlayerSaveSlot"));
+    }
 }
\ No newline at end of file
@@ -7,6 +7,7 @@
 #include "ItemData.h"
 #include "GameFramework/Actor.h"
 #include "Components/BoxComponent.h"
+#include "Components/SphereComponent.h"
 #include "BridgeZone.generated.h"
 
 class UStaticMeshComponent;
@@ -41,9 +42,15 @@ protected:
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
     USceneComponent* RootScene;
 
-public:
-    virtual void Tick(float DeltaTime) override;
+    // Far end of the bridge; reaching it enters a streamed destination island
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
+    UBoxComponent* ArrivalVolume;
+
+    // Approach radius; the destination starts preloading well before the prompt shows
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
+    USphereComponent* PreloadVolume;
 
+public:
     // Bridge State
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Bridge Settings")
     EBridgeZoneState BridgeState;
@@ -52,10 +59,14 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Bridge Settings")
     TArray<FCraftingRequirement> BuildingCost;
 
-    // Level to load when traveling
+    // Level to travel to: streamed in if it is a sublevel of this world, opened with OpenLevel otherwise
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Bridge Settings")
     FName DestinationLevelName;
 
+    // Walking inside this distance preloads the destination, walking back out cancels it
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Bridge Settings", meta = (ClampMin = "0"))
+    float PreloadRadius = 1500.f;
+
     // UI Widget
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UI")
     TSubclassOf<UBridgePromptWidget> PromptWidgetClass;
@@ -69,6 +80,9 @@ protected:
 
     bool bPlayerInZone;
 
+    // Set once OpenLevel has been called; the zone is on its way out with the level
+    bool bTravelPending = false;
+
     // Trigger callbacks
     UFUNCTION()
     void OnTriggerBeginOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
@@ -78,6 +92,22 @@ protected:
     void OnTriggerEndOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
         UPrimitiveComponent* OtherComp, int OtherBodyIndex);
 
+    UFUNCTION()
+    void OnPreloadBeginOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
+        UPrimitiveComponent* OtherComp, int OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
+
+    UFUNCTION()
+    void OnPreloadEndOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
+        UPrimitiveComponent* OtherComp, int OtherBodyIndex);
+
+    UFUNCTION()
+    void OnArrivalBeginOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
+        UPrimitiveComponent* OtherComp, int OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
+
+    // The destination finished streaming while the player may already be waiting at the far end
+    UFUNCTION()
+    void OnDestinationShown();
+
 public:
     // Called by the UI widget
     UFUNCTION(BlueprintCallable, Category = "Bridge")
@@ -101,4 +131,17 @@ protected:
     void HidePrompt();
     void BuildBridge();
     void TravelToNextIsland();
+    void OpenDestinationLevel();
+
+    // Asset preload for the destination, plus its map package or sublevel where that applies
+    void PreloadDestination();
+
+    // Whether DestinationLevelName is a streaming sublevel of this world
+    bool IsDestinationStreamed() const;
+
+    // Player reached the far end with the destination visible
+    void CompleteStreamedCrossing(APaperChar* Player);
+
+    // Show the bridge if the save says it was built; re-run when the deferred load lands
+    void RestoreFromSave();
 };
\ No newline at end of file
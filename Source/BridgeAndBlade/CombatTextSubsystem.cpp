@@ -0,0 +1,163 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "CombatTextSubsystem.h"
+#include "Components/TextRenderComponent.h"
+#include "Components/SceneComponent.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Kismet/GameplayStatics.h"
+#include "Engine/World.h"
+
+bool UCombatTextSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UCombatTextSubsystem::Deinitialize()
+{
+    ActivePopups.Empty();
+    FreePoolIndices.Empty();
+    Pool.Empty();
+    PoolOwner = nullptr;
+
+    Super::Deinitialize();
+}
+
+TStatId UCombatTextSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UCombatTextSubsystem, STATGROUP_Tickables);
+}
+
+void UCombatTextSubsystem::ReportHealthChange(AActor* Target, int32 Delta)
+{
+    if (!Target || Delta == 0)
+        return;
+
+    const bool bHeal = Delta > 0;
+
+    // Merge into a recent popup on the same target instead of stacking a new one
+    for (FCombatPopup& Popup : ActivePopups)
+    {
+        if (Popup.Target == Target && Popup.bHeal == bHeal && Popup.Age <= CoalesceWindow)
+        {
+            Popup.Amount += FMath::Abs(Delta);
+            RefreshPopupText(Popup);
+            return;
+        }
+    }
+
+    // At the cap, recycle the oldest popup so the newest number is always visible
+    if (ActivePopups.Num() >= FMath::Max(1, MaxActivePopups))
+    {
+        ReleasePopup(0);
+    }
+
+    const int32 PoolIndex = AcquirePoolIndex();
+    if (PoolIndex == INDEX_NONE)
+        return;
+
+    FCombatPopup& Popup = ActivePopups.AddDefaulted_GetRef();
+    Popup.Target = Target;
+    Popup.Anchor = Target->GetActorLocation();
+    Popup.Amount = FMath::Abs(Delta);
+    Popup.bHeal = bHeal;
+    Popup.PoolIndex = PoolIndex;
+
+    UTextRenderComponent* Text = Pool[PoolIndex];
+    Text->SetTextRenderColor(bHeal ? FColor::Green : FColor::Red);
+    Text->SetWorldLocation(Popup.Anchor + FVector(0.f, 0.f, VerticalOffset));
+    Text->SetVisibility(true);
+    RefreshPopupText(Popup);
+}
+
+void UCombatTextSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    if (ActivePopups.Num() == 0)
+        return;
+
+    // Face the camera so the numbers read flat on screen
+    FRotator FacingRotation = FRotator::ZeroRotator;
+    if (APlayerCameraManager* CameraManager = UGameplayStatics::GetPlayerCameraManager(GetWorld(), 0))
+    {
+        const FRotationMatrix CameraMatrix(CameraManager->GetCameraRotation());
+        FacingRotation = FRotationMatrix::MakeFromXZ(-CameraMatrix.GetUnitAxis(EAxis::X), CameraMatrix.GetUnitAxis(EAxis::Z)).Rotator();
+    }
+
+    for (int32 i = ActivePopups.Num() - 1; i >= 0; --i)
+    {
+        FCombatPopup& Popup = ActivePopups[i];
+        Popup.Age += DeltaTime;
+
+        if (Popup.Age >= PopupLifetime)
+        {
+            ReleasePopup(i);
+            continue;
+        }
+
+        const float Alpha = Popup.Age / PopupLifetime;
+        UTextRenderComponent* Text = Pool[Popup.PoolIndex];
+        Text->SetWorldLocationAndRotation(Popup.Anchor + FVector(0.f, 0.f, VerticalOffset + RiseDistance * Alpha), FacingRotation);
+    }
+}
+
+int32 UCombatTextSubsystem::AcquirePoolIndex()
+{
+    if (FreePoolIndices.Num() > 0)
+    {
+        return FreePoolIndices.Pop(EAllowShrinking::No);
+    }
+
+    UWorld* World = GetWorld();
+    if (!World)
+        return INDEX_NONE;
+
+    // Lazily create the owner the first time a number is shown (actors can't be spawned during Initialize)
+    if (!PoolOwner)
+    {
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.ObjectFlags |= RF_Transient;
+        PoolOwner = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParams);
+        if (!PoolOwner)
+            return INDEX_NONE;
+
+        USceneComponent* Root = NewObject<USceneComponent>(PoolOwner, TEXT("CombatTextRoot"));
+        PoolOwner->SetRootComponent(Root);
+        Root->RegisterComponent();
+    }
+
+    UTextRenderComponent* Text = NewObject<UTextRenderComponent>(PoolOwner);
+    Text->SetHorizontalAlignment(EHTA_Center);
+    Text->SetVerticalAlignment(EVRTA_TextCenter);
+    Text->SetWorldSize(TextWorldSize);
+    Text->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+    Text->SetCastShadow(false);
+    Text->SetVisibility(false);
+    Text->RegisterComponent();
+
+    return Pool.Add(Text);
+}
+
+void UCombatTextSubsystem::ReleasePopup(int32 PopupIndex)
+{
+    if (!ActivePopups.IsValidIndex(PopupIndex))
+        return;
+
+    const int32 PoolIndex = ActivePopups[PopupIndex].PoolIndex;
+    if (Pool.IsValidIndex(PoolIndex) && Pool[PoolIndex])
+    {
+        Pool[PoolIndex]->SetVisibility(false);
+        FreePoolIndices.Add(PoolIndex);
+    }
+
+    // Keep oldest-first ordering for the cap
+    ActivePopups.RemoveAt(PopupIndex, 1, EAllowShrinking::No);
+}
+
+void UCombatTextSubsystem::RefreshPopupText(const FCombatPopup& Popup)
+{
+    if (Pool.IsValidIndex(Popup.PoolIndex) && Pool[Popup.PoolIndex])
+    {
+        Pool[Popup.PoolIndex]->SetText(FText::AsNumber(Popup.Amount));
+    }
+}
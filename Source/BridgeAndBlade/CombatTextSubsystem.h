@@ -0,0 +1,79 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CombatTextSubsystem.generated.h"
+
+class UTextRenderComponent;
+
+/**
+ * Floating damage / heal numbers drawn from a pool of reusable text renderers.
+ * Health changes are pushed in as events; changes on the same target inside
+ * CoalesceWindow merge into one popup and the number of live popups is capped.
+ */
+UCLASS(Config = Game)
+class BRIDGEANDBLADE_API UCombatTextSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    // Show a health change above Target (negative = damage, positive = heal)
+    UFUNCTION(BlueprintCallable, Category = "Combat Text")
+    void ReportHealthChange(AActor* Target, int32 Delta);
+
+    // Seconds a popup stays on screen
+    UPROPERTY(Config)
+    float PopupLifetime = 1.5f;
+
+    // Changes on the same target within this many seconds of a popup appearing are added to it
+    UPROPERTY(Config)
+    float CoalesceWindow = 0.3f;
+
+    // Hard cap on simultaneous popups; the oldest one is recycled when full
+    UPROPERTY(Config)
+    int32 MaxActivePopups = 24;
+
+    // Height above the target where popups start, and how far they rise over their lifetime
+    UPROPERTY(Config)
+    float VerticalOffset = 100.0f;
+
+    UPROPERTY(Config)
+    float RiseDistance = 60.0f;
+
+    UPROPERTY(Config)
+    float TextWorldSize = 48.0f;
+
+private:
+    struct FCombatPopup
+    {
+        TWeakObjectPtr<AActor> Target;
+        FVector Anchor = FVector::ZeroVector;
+        float Age = 0.0f;
+        int32 Amount = 0;
+        bool bHeal = false;
+        int32 PoolIndex = INDEX_NONE;
+    };
+
+    // Transient actor that owns the pooled text components
+    UPROPERTY(Transient)
+    TObjectPtr<AActor> PoolOwner;
+
+    UPROPERTY(Transient)
+    TArray<TObjectPtr<UTextRenderComponent>> Pool;
+
+    TArray<int32> FreePoolIndices;
+
+    // Ordered oldest first
+    TArray<FCombatPopup> ActivePopups;
+
+    int32 AcquirePoolIndex();
+    void ReleasePopup(int32 PopupIndex);
+    void RefreshPopupText(const FCombatPopup& Popup);
+};
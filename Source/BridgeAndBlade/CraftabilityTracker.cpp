@@ -0,0 +1,62 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "CraftabilityTracker.h"
+#include "ItemDatabase.h"
+
+void FCraftabilityTracker::Rebuild(const UItemDatabase& Database, const TArray<int32>& Counts, TArray<FItemId>& OutFlipped)
+{
+    const int32 NumItems = Database.GetNumItems();
+    TArray<uint16> Previous = MoveTemp(Unsatisfied);
+    Unsatisfied.SetNumUninitialized(NumItems);
+
+    for (int32 Index = 0; Index < NumItems; ++Index)
+    {
+        const FItemId Recipe((uint16)Index);
+        uint16 Missing = NotARecipe;
+
+        if (Database.GetItemAt(Index)->bIsCraftable)
+        {
+            Missing = 0;
+            for (const FItemRequirement& Requirement : Database.GetRequirements(Recipe))
+            {
+                const int32 Owned = Counts.IsValidIndex(Requirement.ItemId.ToIndex()) ? Counts[Requirement.ItemId.ToIndex()] : 0;
+                Missing += Owned < Requirement.Amount ? 1 : 0;
+            }
+        }
+        Unsatisfied[Index] = Missing;
+
+        const bool bWas = Previous.IsValidIndex(Index) && Previous[Index] == 0;
+        if (bWas != (Missing == 0))
+        {
+            OutFlipped.Add(Recipe);
+        }
+    }
+}
+
+void FCraftabilityTracker::OnCountChanged(const UItemDatabase& Database, FItemId Material, int32 OldCount, int32 NewCount, TArray<FItemId>& OutFlipped)
+{
+    if (OldCount == NewCount || !IsBuilt())
+        return;
+
+    // A single change moves every affected recipe the same way, so each flips at most once
+    for (const FRecipeUse& Use : Database.GetRecipesUsing(Material))
+    {
+        const bool bWasMet = OldCount >= Use.Amount;
+        const bool bIsMet = NewCount >= Use.Amount;
+        if (bWasMet == bIsMet)
+            continue;
+
+        uint16& Missing = Unsatisfied[Use.RecipeId.ToIndex()];
+        if (bIsMet)
+        {
+            if (--Missing == 0)
+            {
+                OutFlipped.Add(Use.RecipeId);
+            }
+        }
+        else if (Missing++ == 0)
+        {
+            OutFlipped.Add(Use.RecipeId);
+        }
+    }
+}
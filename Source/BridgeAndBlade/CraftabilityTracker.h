@@ -0,0 +1,39 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ItemData.h"
+
+class UItemDatabase;
+
+/**
+ * Keeps, per craftable recipe, how many of its requirement lines are not yet met by an inventory.
+ * A count change on one material only touches the recipes that use it (via the database's
+ * reverse index) and reports the recipes whose craftable state flipped.
+ */
+class BRIDGEANDBLADE_API FCraftabilityTracker
+{
+public:
+    // Recompute from scratch; OutFlipped receives every recipe whose state differs from before
+    void Rebuild(const UItemDatabase& Database, const TArray<int32>& Counts, TArray<FItemId>& OutFlipped);
+
+    // Material went from OldCount to NewCount
+    void OnCountChanged(const UItemDatabase& Database, FItemId Material, int32 OldCount, int32 NewCount, TArray<FItemId>& OutFlipped);
+
+    bool IsBuilt() const { return Unsatisfied.Num() > 0; }
+
+    bool IsCraftable(FItemId Recipe) const
+    {
+        return Recipe.IsValid() && Unsatisfied.IsValidIndex(Recipe.ToIndex()) && Unsatisfied[Recipe.ToIndex()] == 0;
+    }
+
+    void Reset() { Unsatisfied.Reset(); }
+
+private:
+    // Marks items that are not craftable recipes
+    static constexpr uint16 NotARecipe = MAX_uint16;
+
+    // Unmet requirement lines per item id
+    TArray<uint16> Unsatisfied;
+};
@@ -7,6 +7,8 @@
 #include "Components/Button.h"
 #include "PaperChar.h"
 #include "InventoryWidget.h"
+#include "InventoryListItem.h"
+#include "ItemDatabase.h"
 
 void UCraftingItemWidget::NativeConstruct()
 {
@@ -14,13 +16,20 @@ void UCraftingItemWidget::NativeConstruct()
 
     if (CraftButton)
     {
-        CraftButton->OnClicked.AddDynamic(this, &UCraftingItemWidget::OnCraftButtonClicked);
+        // Unique: pooled list entries are constructed again each time they are reused
+        CraftButton->OnClicked.AddUniqueDynamic(this, &UCraftingItemWidget::OnCraftButtonClicked);
     }
 }
 
 void UCraftingItemWidget::SetItemData(const FItemData& Data, APaperChar* Character, UInventoryWidget* InvWidget)
 {
-    ItemData = Data;
+    ShowItemData(Data, Character, InvWidget);
+    UpdateCraftability();
+}
+
+void UCraftingItemWidget::ShowItemData(const FItemData& Data, APaperChar* Character, UInventoryWidget* InvWidget)
+{
+    ItemName = Data.ItemName;
     OwningCharacter = Character;
     InventoryWidget = InvWidget;
 
@@ -29,9 +38,18 @@ void UCraftingItemWidget::SetItemData(const FItemData& Data, APaperChar* Charact
         ItemNameText->SetText(Data.DisplayName);
     }
 
-    if (ItemIcon && Data.Icon)
+    if (ItemIcon)
     {
-        ItemIcon->SetBrushFromTexture(Data.Icon);
+        // Recycled rows must not keep the previous item's icon
+        UItemDatabase* DB = UItemDatabase::Get(this);
+        if (UTexture2D* Icon = DB ? DB->GetItemIcon(Data) : Data.Icon.LoadSynchronous())
+        {
+            ItemIcon->SetBrushFromTexture(Icon);
+        }
+        else
+        {
+            ItemIcon->SetBrush(FSlateBrush());
+        }
     }
 
     // Build requirements text
@@ -50,16 +68,34 @@ void UCraftingItemWidget::SetItemData(const FItemData& Data, APaperChar* Charact
         }
         RequirementsText->SetText(FText::FromString(ReqText));
     }
+}
 
-    UpdateCraftability();
+void UCraftingItemWidget::NativeOnListItemObjectSet(UObject* ListItemObject)
+{
+    const UInventoryListItem* Item = Cast<UInventoryListItem>(ListItemObject);
+    UItemDatabase* DB = UItemDatabase::Get(this);
+    const FItemData* Data = Item && DB ? DB->GetItemAt(Item->ItemIndex) : nullptr;
+    if (Data)
+    {
+        // The model already knows whether it is craftable; no need to ask the inventory again
+        ShowItemData(*Data, Item->OwningCharacter.Get(), GetTypedOuter<UInventoryWidget>());
+        SetCraftable(Item->bCraftable);
+    }
 }
 
 void UCraftingItemWidget::UpdateCraftability()
 {
-    if (!CraftButton || !OwningCharacter)
+    if (!OwningCharacter)
+        return;
+
+    SetCraftable(OwningCharacter->CanCraftItem(ItemName));
+}
+
+void UCraftingItemWidget::SetCraftable(bool bCanCraft)
+{
+    if (!CraftButton)
         return;
 
-    bool bCanCraft = OwningCharacter->CanCraftItem(ItemData.ItemName);
     CraftButton->SetIsEnabled(bCanCraft);
 
     // Change button color based on craftability
@@ -78,13 +114,6 @@ void UCraftingItemWidget::OnCraftButtonClicked()
     if (!OwningCharacter)
         return;
 
-    if (OwningCharacter->CraftItem(ItemData.ItemName))
-    {
-        // Refresh the inventory display
-        if (InventoryWidget)
-        {
-            InventoryWidget->RefreshInventory();
-            InventoryWidget->RefreshCraftingList();
-        }
-    }
+    // Inventory rows and the crafting rows whose state flipped update from the inventory's events
+    OwningCharacter->CraftItem(ItemName);
 }
\ No newline at end of file
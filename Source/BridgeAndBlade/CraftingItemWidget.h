@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Blueprint/UserWidget.h"
+#include "Blueprint/IUserObjectListEntry.h"
 #include "ItemData.h"
 #include "CraftingItemWidget.generated.h"
 
@@ -14,7 +15,7 @@ class APaperChar;
 class UInventoryWidget;
 
 UCLASS()
-class BRIDGEANDBLADE_API UCraftingItemWidget : public UUserWidget
+class BRIDGEANDBLADE_API UCraftingItemWidget : public UUserWidget, public IUserObjectListEntry
 {
     GENERATED_BODY()
 
@@ -27,7 +28,13 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Crafting")
     void UpdateCraftability();
 
+    // Apply a craftable state that is already known (e.g. from the inventory's craftability tracker)
+    void SetCraftable(bool bCanCraft);
+
 protected:
+    // List view entry: called with a UInventoryListItem whenever this (possibly recycled) row is reused
+    virtual void NativeOnListItemObjectSet(UObject* ListItemObject) override;
+
     UPROPERTY(meta = (BindWidget))
     UTextBlock* ItemNameText;
 
@@ -40,8 +47,8 @@ protected:
     UPROPERTY(meta = (BindWidget))
     UButton* CraftButton;
 
-    UPROPERTY()
-    FItemData ItemData;
+    // Recipe this row crafts
+    FName ItemName;
 
     UPROPERTY()
     APaperChar* OwningCharacter;
@@ -51,4 +58,7 @@ protected:
 
     UFUNCTION()
     void OnCraftButtonClicked();
+
+    // Everything SetItemData shows except craftability
+    void ShowItemData(const FItemData& Data, APaperChar* Character, UInventoryWidget* InvWidget);
 };
\ No newline at end of file
@@ -17,9 +17,7 @@ AEnemyAIController::AEnemyAIController()
     PrimaryActorTick.bCanEverTick = true;
     
     CurrentState = EEnemyState::Patrolling;
-    PatrolTimer = 0.0f;
     LastKnownPlayerLocation = FVector::ZeroVector;
-    ChaseTimeOutsideZone = 0.0f;
     MaxChaseTimeOutsideZone = FMath::FRandRange(5.0f, 10.0f);
 
 }
@@ -140,7 +138,7 @@ void AEnemyAIController::OnEnemyHit(AActor* SelfActor, AActor* OtherActor, FVect
 
     // Update patrol point and immediately move there
     CurrentPatrolPoint = NewPatrolPoint;
-    PatrolTimer = 0.0f;
+    ClearWheelTimer(PatrolWaitHandle);
     StopMovement();
     MoveToLocation(CurrentPatrolPoint, 50.0f);
 
@@ -217,23 +215,19 @@ void AEnemyAIController::HandlePatrolling(float DeltaSeconds)
 
     if (DistanceToPatrolPoint < 50.0f) // Reached patrol point
     {
-        // Wait at patrol point
-        PatrolTimer += DeltaSeconds;
-        
-        if (PatrolTimer >= PatrolWaitTime)
-        {
-            // Pick new random patrol point
-            CurrentPatrolPoint = GetRandomPatrolPoint();
-            PatrolTimer = 0.0f;
-            
-            //UE_LOG(LogTemp, Log, TEXT("Enemy %s picked new patrol point at %s"), 
-             //   *ControlledPawn->GetName(), *CurrentPatrolPoint.ToString());
-            
-            MoveToLocation(CurrentPatrolPoint, 50.0f);
-        }
-        else
+        // Wait at patrol point; OnPatrolWaitElapsed picks the next one
+        if (!IsWheelTimerActive(PatrolWaitHandle))
         {
             StopMovement();
+
+            if (UTimerWheelSubsystem* Timers = UTimerWheelSubsystem::Get(this))
+            {
+                Timers->SetTimer(PatrolWaitHandle, this, &AEnemyAIController::OnPatrolWaitElapsed, PatrolWaitTime);
+            }
+            else
+            {
+                OnPatrolWaitElapsed();
+            }
         }
     }
     else
@@ -260,7 +254,7 @@ void AEnemyAIController::HandlePatrolling(float DeltaSeconds)
                 // Pick a new patrol point immediately
                 //UE_LOG(LogTemp, Warning, TEXT("  Generating new patrol point..."));
                 CurrentPatrolPoint = GetRandomPatrolPoint();
-                PatrolTimer = PatrolWaitTime;
+                ClearWheelTimer(PatrolWaitHandle);
             }
         }
     }
@@ -280,7 +274,7 @@ void AEnemyAIController::HandlePatrolling(float DeltaSeconds)
         CurrentPatrolPoint = ControlledPawn->GetActorLocation() + (NewDirection * NewDistance);
         CurrentPatrolPoint.Z = SpawnLocation.Z;
         
-        PatrolTimer = 0.0f;
+        ClearWheelTimer(PatrolWaitHandle);
         MoveToLocation(CurrentPatrolPoint, 50.0f);
         return;
     }
@@ -297,7 +291,6 @@ void AEnemyAIController::HandleChasing(float DeltaSeconds)
         //UE_LOG(LogTemp, Warning, TEXT("Enemy %s: Player lost, returning"), *ControlledPawn->GetName());
         StopMovement();
         SetState(EEnemyState::Patrolling);
-        ChaseTimeOutsideZone = 0.0f;
         return;
     }
 
@@ -308,38 +301,35 @@ void AEnemyAIController::HandleChasing(float DeltaSeconds)
     if (bCanSeePlayer)
     {
         LastKnownPlayerLocation = PlayerPawn->GetActorLocation();
-        ChaseTimeOutsideZone = 0.0f; // Reset timer when we can see player
+        ResetChaseTimeout(); // Reset timeout when we can see player
     }
-
-    // If player left the patrol zone, start counting timeout
-    if (!bPlayerInZone)
+    else if (UTimerWheelSubsystem* Timers = UTimerWheelSubsystem::Get(this))
     {
-        ChaseTimeOutsideZone += DeltaSeconds;
-        
-        if (ChaseTimeOutsideZone >= MaxChaseTimeOutsideZone)
+        const bool bTimeoutRunning = Timers->IsTimerActive(ChaseTimeoutHandle);
+        if (!bPlayerInZone && !bTimeoutRunning)
         {
-            //UE_LOG(LogTemp, Warning, TEXT("Enemy %s: Player left patrol zone too long, returning"), *ControlledPawn->GetName());
-            StopMovement();
-            SetState(EEnemyState::Patrolling);
-            ChaseTimeOutsideZone = 0.0f;
-            return;
+            // Player left the patrol zone unseen, give up after MaxChaseTimeOutsideZone in total (OnChaseTimeout)
+            Timers->SetTimer(ChaseTimeoutHandle, this, &AEnemyAIController::OnChaseTimeout,
+                FMath::Max(MaxChaseTimeOutsideZone - ChaseTimeOutsideZone, 0.0f));
+        }
+        else if (bPlayerInZone && bTimeoutRunning)
+        {
+            // Back in the zone but still unseen: pause, keeping the time already spent outside
+            ChaseTimeOutsideZone = MaxChaseTimeOutsideZone - Timers->GetTimerRemaining(ChaseTimeoutHandle);
+            ClearWheelTimer(ChaseTimeoutHandle);
         }
     }
 
     // If lost sight of player, go to last known location
     if (bRequireLineOfSight && !bCanSeePlayer)
     {
-        TimeSearchingLastKnown += DeltaSeconds;
-        
-        // Give up if we've been searching too long
-        if (TimeSearchingLastKnown >= MaxSearchTime)
+        // Give up if we search for too long (OnSearchTimeout)
+        if (!IsWheelTimerActive(SearchTimeoutHandle))
         {
-            //UE_LOG(LogTemp, Warning, TEXT("Enemy %s: Searched too long, giving up"), *ControlledPawn->GetName());
-            StopMovement();
-            SetState(EEnemyState::Patrolling);
-            TimeSearchingLastKnown = 0.0f;
-            ChaseTimeOutsideZone = 0.0f;
-            return;
+            if (UTimerWheelSubsystem* Timers = UTimerWheelSubsystem::Get(this))
+            {
+                Timers->SetTimer(SearchTimeoutHandle, this, &AEnemyAIController::OnSearchTimeout, MaxSearchTime);
+            }
         }
         
         const FVector MyLocation = ControlledPawn->GetActorLocation();
@@ -360,8 +350,6 @@ void AEnemyAIController::HandleChasing(float DeltaSeconds)
                     //UE_LOG(LogTemp, Warning, TEXT("Enemy %s: Can't reach last known location, returning to patrol"), *ControlledPawn->GetName());
                     StopMovement();
                     SetState(EEnemyState::Patrolling);
-                    TimeSearchingLastKnown = 0.0f;
-                    ChaseTimeOutsideZone = 0.0f;
                     return;
                 }
             }
@@ -375,15 +363,13 @@ void AEnemyAIController::HandleChasing(float DeltaSeconds)
             //UE_LOG(LogTemp, Warning, TEXT("Enemy %s: Reached last known location, player not found, returning"), *ControlledPawn->GetName());
             StopMovement();
             SetState(EEnemyState::Patrolling);
-            TimeSearchingLastKnown = 0.0f;
-            ChaseTimeOutsideZone = 0.0f;
             return;
         }
     }
     else
     {
-        // Can see player, reset search timer
-        TimeSearchingLastKnown = 0.0f;
+        // Can see player, cancel the search countdown
+        ClearWheelTimer(SearchTimeoutHandle);
     }
 
     APaperEnemy* EnemyPawn = Cast<APaperEnemy>(ControlledPawn);
@@ -398,7 +384,7 @@ void AEnemyAIController::HandleChasing(float DeltaSeconds)
     if (DistanceSqr <= AttackRangeSqr)
     {
         SetState(EEnemyState::Attacking);
-        ChaseTimeOutsideZone = 0.0f;
+        ResetChaseTimeout();
         return;
     }
 
@@ -479,7 +465,6 @@ void AEnemyAIController::HandleReturning(float DeltaSeconds)
     {
         // Resume patrolling with a new random point
         CurrentPatrolPoint = GetRandomPatrolPoint();
-        PatrolTimer = 0.0f;
         //UE_LOG(LogTemp, Log, TEXT("Enemy %s: Reached spawn, resuming patrol"), *ControlledPawn->GetName());
         SetState(EEnemyState::Patrolling);
         MoveToLocation(CurrentPatrolPoint, 50.0f);
@@ -637,15 +622,72 @@ void AEnemyAIController::SetState(EEnemyState NewState)
         // Reset relevant timers/variables on state change
         if (NewState == EEnemyState::Patrolling)
         {
-            PatrolTimer = 0.0f;
-            ChaseTimeOutsideZone = 0.0f;
-            TimeSearchingLastKnown = 0.0f;
+            ClearWheelTimer(PatrolWaitHandle);
+            ResetChaseTimeout();
+            ClearWheelTimer(SearchTimeoutHandle);
         }
         else if (NewState == EEnemyState::Chasing)
         {
             MaxChaseTimeOutsideZone = FMath::FRandRange(5.0f, 10.0f);
-            TimeSearchingLastKnown = 0.0f;
+            ClearWheelTimer(SearchTimeoutHandle);
         }
     }
 }
 
+void AEnemyAIController::OnPatrolWaitElapsed()
+{
+    if (CurrentState != EEnemyState::Patrolling)
+    {
+        return;
+    }
+
+    // Pick new random patrol point
+    CurrentPatrolPoint = GetRandomPatrolPoint();
+
+    //UE_LOG(LogTemp, Log, TEXT("Enemy %s picked new patrol point at %s"), 
+     //   *GetPawn()->GetName(), *CurrentPatrolPoint.ToString());
+
+    MoveToLocation(CurrentPatrolPoint, 50.0f);
+}
+
+void AEnemyAIController::OnChaseTimeout()
+{
+    if (CurrentState == EEnemyState::Chasing)
+    {
+        //UE_LOG(LogTemp, Warning, TEXT("Enemy %s: Player left patrol zone too long, returning"), *GetPawn()->GetName());
+        StopMovement();
+        SetState(EEnemyState::Patrolling);
+    }
+}
+
+void AEnemyAIController::OnSearchTimeout()
+{
+    if (CurrentState == EEnemyState::Chasing)
+    {
+        //UE_LOG(LogTemp, Warning, TEXT("Enemy %s: Searched too long, giving up"), *GetPawn()->GetName());
+        StopMovement();
+        SetState(EEnemyState::Patrolling);
+    }
+}
+
+void AEnemyAIController::ClearWheelTimer(FWheelTimerHandle& Handle)
+{
+    if (UTimerWheelSubsystem* Timers = UTimerWheelSubsystem::Get(this))
+    {
+        Timers->ClearTimer(Handle);
+    }
+    Handle.Invalidate();
+}
+
+void AEnemyAIController::ResetChaseTimeout()
+{
+    ClearWheelTimer(ChaseTimeoutHandle);
+    ChaseTimeOutsideZone = 0.0f;
+}
+
+bool AEnemyAIController::IsWheelTimerActive(const FWheelTimerHandle& Handle) const
+{
+    const UTimerWheelSubsystem* Timers = UTimerWheelSubsystem::Get(this);
+    return Timers && Timers->IsTimerActive(Handle);
+}
+
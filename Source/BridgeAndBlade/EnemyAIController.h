@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "AIController.h"
+#include "TimerWheelSubsystem.h"
 #include "EnemyAIController.generated.h"
 
 class UBehaviorTree;
@@ -47,7 +48,6 @@ public:
 protected:
     FVector SpawnLocation;
     EEnemyState CurrentState;
-    float PatrolTimer;
     FVector CurrentPatrolPoint;
 
     // Make handlers virtual so subclasses can override behavior
@@ -68,9 +68,22 @@ protected:
     bool CheckForObstaclesAhead(float LookAheadDistance = 150.0f) const;
 
     FVector LastKnownPlayerLocation;
-    float ChaseTimeOutsideZone;
     float MaxChaseTimeOutsideZone;
-
-    float TimeSearchingLastKnown;
     float MaxSearchTime;
+
+    // Expirations registered on the timer wheel instead of counters accumulated every tick
+    FWheelTimerHandle PatrolWaitHandle;
+    FWheelTimerHandle ChaseTimeoutHandle;
+    FWheelTimerHandle SearchTimeoutHandle;
+
+    // Chase timeout already used up; the timer is paused while the player is back in the zone unseen
+    float ChaseTimeOutsideZone = 0.0f;
+
+    void OnPatrolWaitElapsed();
+    void OnChaseTimeout();
+    void OnSearchTimeout();
+
+    void ClearWheelTimer(FWheelTimerHandle& Handle);
+    void ResetChaseTimeout();
+    bool IsWheelTimerActive(const FWheelTimerHandle& Handle) const;
 };
@@ -0,0 +1,293 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "InventoryComponent.h"
+#include "ItemDatabase.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+
+UInventoryComponent::UInventoryComponent()
+{
+    PrimaryComponentTick.bCanEverTick = false;
+}
+
+void UInventoryComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    // Don't drop the last frame of changes on travel / quit
+    FlushChanges();
+
+    Super::EndPlay(EndPlayReason);
+}
+
+UItemDatabase* UInventoryComponent::GetDatabase() const
+{
+    return UItemDatabase::Get(this);
+}
+
+void UInventoryComponent::EnsureInitialized(UItemDatabase& Database)
+{
+    if (Counts.Num() < Database.GetNumItems())
+    {
+        Counts.SetNumZeroed(Database.GetNumItems());
+    }
+
+    if (PendingSlots.Num() < Counts.Num())
+    {
+        PendingSlots.Init(INDEX_NONE, Counts.Num());
+        for (int32 i = 0; i < PendingDeltas.Num(); ++i)
+        {
+            PendingSlots[PendingDeltas[i].ItemId.ToIndex()] = i;
+        }
+    }
+}
+
+void UInventoryComponent::SetCount(FItemId Id, int32 NewCount, EInventoryChangeReason Reason)
+{
+    const int32 Index = Id.ToIndex();
+    const int32 OldCount = Counts[Index];
+    if (OldCount == NewCount)
+        return;
+
+    Counts[Index] = NewCount;
+
+    // Coalesce: keep the first old count of the frame, update the rest
+    int32& Slot = PendingSlots[Index];
+    if (Slot == INDEX_NONE)
+    {
+        Slot = PendingDeltas.Add({ Id, OldCount, NewCount, Reason });
+    }
+    else
+    {
+        PendingDeltas[Slot].NewCount = NewCount;
+        PendingDeltas[Slot].Reason = Reason;
+    }
+
+    if (!bFlushScheduled)
+    {
+        if (UWorld* World = GetWorld())
+        {
+            bFlushScheduled = true;
+            World->GetTimerManager().SetTimerForNextTick(this, &UInventoryComponent::FlushChanges);
+        }
+    }
+}
+
+void UInventoryComponent::FlushChanges()
+{
+    bFlushScheduled = false;
+    if (PendingDeltas.Num() == 0)
+        return;
+
+    // Take the batch first so subscribers can mutate the inventory (that lands in the next batch)
+    TArray<FInventoryDelta> Deltas = MoveTemp(PendingDeltas);
+    PendingDeltas.Reset();
+    for (const FInventoryDelta& Delta : Deltas)
+    {
+        PendingSlots[Delta.ItemId.ToIndex()] = INDEX_NONE;
+    }
+
+    // Items that ended the frame where they started are not a change
+    Deltas.RemoveAll([](const FInventoryDelta& Delta) { return Delta.OldCount == Delta.NewCount; });
+    if (Deltas.Num() == 0)
+        return;
+
+    TArray<FItemId> Flipped;
+    if (UItemDatabase* DB = GetDatabase())
+    {
+        if (Craftability.IsBuilt())
+        {
+            for (const FInventoryDelta& Delta : Deltas)
+            {
+                Craftability.OnCountChanged(*DB, Delta.ItemId, Delta.OldCount, Delta.NewCount, Flipped);
+            }
+        }
+        else
+        {
+            // Counts already hold this batch, so build from them instead of replaying it
+            Craftability.Rebuild(*DB, Counts, Flipped);
+        }
+    }
+
+    OnInventoryChanged.Broadcast(Deltas);
+
+    if (Flipped.Num() > 0)
+    {
+        OnCraftabilityChanged.Broadcast(Flipped);
+    }
+}
+
+int32 UInventoryComponent::AddItem(FItemId Id, int32 Amount, EInventoryChangeReason Reason)
+{
+    UItemDatabase* DB = GetDatabase();
+    const FItemData* ItemData = DB ? DB->GetItem(Id) : nullptr;
+    if (!ItemData || Amount <= 0)
+        return 0;
+
+    EnsureInitialized(*DB);
+
+    const int32 Previous = Counts[Id.ToIndex()];
+    int32 Added = Amount;
+
+    if (ItemData->ItemType == EItemType::Weapon)
+    {
+        // Every weapon is its own instance
+        for (int32 i = 0; i < Amount; ++i)
+        {
+            Weapons.Add(Id);
+        }
+    }
+    else
+    {
+        Added = FMath::Max(0, FMath::Min(Previous + Amount, ItemData->MaxStackSize) - Previous);
+    }
+
+    SetCount(Id, Previous + Added, Reason);
+    return Added;
+}
+
+bool UInventoryComponent::RemoveItem(FItemId Id, int32 Amount, EInventoryChangeReason Reason)
+{
+    UItemDatabase* DB = GetDatabase();
+    if (!DB || Amount <= 0 || !HasItem(Id, Amount))
+        return false;
+
+    EnsureInitialized(*DB);
+    SetCount(Id, Counts[Id.ToIndex()] - Amount, Reason);
+
+    // Weapons: drop the most recently added instances first
+    int32 ToRemove = Amount;
+    for (int32 i = Weapons.Num() - 1; i >= 0 && ToRemove > 0; --i)
+    {
+        if (Weapons[i] == Id)
+        {
+            Weapons.RemoveAt(i, 1, EAllowShrinking::No);
+            --ToRemove;
+        }
+    }
+
+    return true;
+}
+
+bool UInventoryComponent::CanCraft(FItemId RecipeId) const
+{
+    UItemDatabase* DB = GetDatabase();
+    const FItemData* Recipe = DB ? DB->GetItem(RecipeId) : nullptr;
+    if (!Recipe || !Recipe->bIsCraftable)
+        return false;
+
+    for (const FItemRequirement& Requirement : DB->GetRequirements(RecipeId))
+    {
+        if (GetCount(Requirement.ItemId) < Requirement.Amount)
+            return false;
+    }
+
+    return true;
+}
+
+bool UInventoryComponent::IsCraftable(FItemId RecipeId) const
+{
+    // Before the first flush nothing has been tracked yet
+    return Craftability.IsBuilt() ? Craftability.IsCraftable(RecipeId) : CanCraft(RecipeId);
+}
+
+void UInventoryComponent::Empty()
+{
+    Weapons.Reset();
+
+    for (int32 Index = 0; Index < Counts.Num(); ++Index)
+    {
+        SetCount(FItemId((uint16)Index), 0, EInventoryChangeReason::Cleared);
+    }
+}
+
+void UInventoryComponent::ExportStacks(TMap<FName, int>& OutStacks) const
+{
+    OutStacks.Reset();
+
+    UItemDatabase* DB = GetDatabase();
+    if (!DB)
+        return;
+
+    for (int32 Index = 0; Index < Counts.Num(); ++Index)
+    {
+        const FItemData* ItemData = DB->GetItemAt(Index);
+        if (Counts[Index] > 0 && ItemData && ItemData->ItemType != EItemType::Weapon)
+        {
+            OutStacks.Add(ItemData->ItemName, Counts[Index]);
+        }
+    }
+}
+
+void UInventoryComponent::ExportWeapons(TArray<FName>& OutWeapons) const
+{
+    OutWeapons.Reset(Weapons.Num());
+
+    if (UItemDatabase* DB = GetDatabase())
+    {
+        for (const FItemId& Id : Weapons)
+        {
+            OutWeapons.Add(DB->GetItemName(Id));
+        }
+    }
+}
+
+void UInventoryComponent::Import(const TMap<FName, int>& Stacks, const TArray<FName>& WeaponNames)
+{
+    UItemDatabase* DB = GetDatabase();
+    if (!DB)
+        return;
+
+    EnsureInitialized(*DB);
+
+    // Bulk load into a scratch array, then publish only the items that differ
+    TArray<int32> Loaded;
+    Loaded.SetNumZeroed(Counts.Num());
+    Weapons.Reset();
+
+    for (const TPair<FName, int>& Stack : Stacks)
+    {
+        const FItemId Id = DB->FindItemId(Stack.Key);
+        if (Id.IsValid())
+        {
+            // Saved counts are restored as-is (no stack clamp) to match what was written
+            Loaded[Id.ToIndex()] = FMath::Max(0, Stack.Value);
+        }
+        else
+        {
+            UE_LOG(LogTemp, Warning, TEXT("Inventory: dropping unknown saved item '%s'"), *Stack.Key.ToString());
+        }
+    }
+
+    Weapons.Reserve(WeaponNames.Num());
+    for (const FName& WeaponName : WeaponNames)
+    {
+        const FItemId Id = DB->FindItemId(WeaponName);
+        if (Id.IsValid())
+        {
+            Weapons.Add(Id);
+            ++Loaded[Id.ToIndex()];
+        }
+        else
+        {
+            UE_LOG(LogTemp, Warning, TEXT("Inventory: dropping unknown saved weapon '%s'"), *WeaponName.ToString());
+        }
+    }
+
+    for (int32 Index = 0; Index < Loaded.Num(); ++Index)
+    {
+        SetCount(FItemId((uint16)Index), Loaded[Index], EInventoryChangeReason::Loaded);
+    }
+}
+
+TMap<FName, int> UInventoryComponent::GetStackedItems() const
+{
+    TMap<FName, int> Stacks;
+    ExportStacks(Stacks);
+    return Stacks;
+}
+
+TArray<FName> UInventoryComponent::GetWeaponNames() const
+{
+    TArray<FName> Names;
+    ExportWeapons(Names);
+    return Names;
+}
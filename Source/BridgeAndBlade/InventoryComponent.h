@@ -0,0 +1,121 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "ItemData.h"
+#include "CraftabilityTracker.h"
+#include "InventoryComponent.generated.h"
+
+class UItemDatabase;
+
+// Why a count changed; when several changes to one item coalesce, the last reason is kept
+UENUM(BlueprintType)
+enum class EInventoryChangeReason : uint8
+{
+    Added,
+    Removed,
+    Crafted,
+    Consumed,
+    Equipped,
+    Unequipped,
+    Loaded,
+    Cleared
+};
+
+// Net change of one item over a frame
+struct FInventoryDelta
+{
+    FItemId ItemId;
+    int32 OldCount = 0;
+    int32 NewCount = 0;
+    EInventoryChangeReason Reason = EInventoryChangeReason::Added;
+};
+
+// Every item whose count changed since the last flush, one entry per item
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnInventoryChanged, TArrayView<const FInventoryDelta> /*Deltas*/);
+
+// Recipes whose craftable state just flipped (query IsCraftable for the new state)
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnCraftabilityChanged, const TArray<FItemId>& /*Recipes*/);
+
+/**
+ * Item storage keyed by dense FItemId. Every item has one slot in a flat counts array
+ * (stack size for materials, number of copies for weapons), so count / add / remove are O(1).
+ * Weapons are additionally kept as an ordered list of instances for equip-by-index.
+ * FName only appears in the Blueprint helpers and the save import / export.
+ *
+ * Mutations are silent at the call site: changes are coalesced per item and published once,
+ * on the next tick, through OnInventoryChanged (then OnCraftabilityChanged).
+ */
+UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
+class BRIDGEANDBLADE_API UInventoryComponent : public UActorComponent
+{
+    GENERATED_BODY()
+
+public:
+    UInventoryComponent();
+
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+    int32 GetCount(FItemId Id) const { return Id.IsValid() && Counts.IsValidIndex(Id.ToIndex()) ? Counts[Id.ToIndex()] : 0; }
+    bool HasItem(FItemId Id, int32 Amount = 1) const { return GetCount(Id) >= Amount; }
+
+    // Add Amount of Id; stackables are clamped to MaxStackSize. Returns the number actually added.
+    int32 AddItem(FItemId Id, int32 Amount = 1, EInventoryChangeReason Reason = EInventoryChangeReason::Added);
+
+    // Remove Amount of Id; fails (and removes nothing) if there isn't enough
+    bool RemoveItem(FItemId Id, int32 Amount = 1, EInventoryChangeReason Reason = EInventoryChangeReason::Removed);
+
+    // Whether every (resolved) requirement of the recipe is satisfied. Authoritative full check.
+    bool CanCraft(FItemId RecipeId) const;
+
+    // Incrementally tracked answer to CanCraft, for UI; current as of the last flush
+    bool IsCraftable(FItemId RecipeId) const;
+
+    FOnInventoryChanged OnInventoryChanged;
+    FOnCraftabilityChanged OnCraftabilityChanged;
+
+    // Publish pending deltas now instead of waiting for the next tick
+    void FlushChanges();
+
+    // Weapon instances in pickup order
+    const TArray<FItemId>& GetWeapons() const { return Weapons; }
+    FItemId GetWeaponAt(int32 Index) const { return Weapons.IsValidIndex(Index) ? Weapons[Index] : FItemId(); }
+    int32 FindWeaponIndex(FItemId Id) const { return Weapons.IndexOfByKey(Id); }
+
+    // Per-id counts; index with FItemId::ToIndex(). May be shorter than the database (missing = 0).
+    const TArray<int32>& GetCounts() const { return Counts; }
+
+    void Empty();
+
+    // Save / Blueprint boundary
+    void ExportStacks(TMap<FName, int>& OutStacks) const;
+    void ExportWeapons(TArray<FName>& OutWeapons) const;
+    void Import(const TMap<FName, int>& Stacks, const TArray<FName>& WeaponNames);
+
+    UFUNCTION(BlueprintPure, Category = "Inventory")
+    TMap<FName, int> GetStackedItems() const;
+
+    UFUNCTION(BlueprintPure, Category = "Inventory")
+    TArray<FName> GetWeaponNames() const;
+
+private:
+    UItemDatabase* GetDatabase() const;
+
+    // Size the per-id arrays to the database
+    void EnsureInitialized(UItemDatabase& Database);
+
+    // Single write path for Counts; records the change in the pending delta for Id
+    void SetCount(FItemId Id, int32 NewCount, EInventoryChangeReason Reason);
+
+    TArray<int32> Counts;
+    TArray<FItemId> Weapons;
+
+    // This frame's deltas, and where each item's entry sits in them (INDEX_NONE = none)
+    TArray<FInventoryDelta> PendingDeltas;
+    TArray<int32> PendingSlots;
+    bool bFlushScheduled = false;
+
+    FCraftabilityTracker Craftability;
+};
@@ -7,29 +7,34 @@
 #include "Components/Button.h"
 #include "PaperChar.h"
 #include "InventoryWidget.h"
+#include "InventoryComponent.h"
+#include "ItemDatabase.h"
+#include "InventoryListItem.h"
 
 void UInventoryItemWidget::NativeConstruct()
 {
 	Super::NativeConstruct();
 
+	// Unique: pooled list entries are constructed again each time they are reused
 	if (EquipButton)
 	{
-		EquipButton->OnClicked.AddDynamic(this, &UInventoryItemWidget::OnEquipButtonClicked);
+		EquipButton->OnClicked.AddUniqueDynamic(this, &UInventoryItemWidget::OnEquipButtonClicked);
 	}
 	if (DeleteButton)
 	{
-		DeleteButton->OnClicked.AddDynamic(this, &UInventoryItemWidget::OnDeleteButtonClicked);
+		DeleteButton->OnClicked.AddUniqueDynamic(this, &UInventoryItemWidget::OnDeleteButtonClicked);
 	}
 	// Bind new assign button if present in the widget
 	if (AssignButton)
 	{
-		AssignButton->OnClicked.AddDynamic(this, &UInventoryItemWidget::OnAssignButtonClicked);
+		AssignButton->OnClicked.AddUniqueDynamic(this, &UInventoryItemWidget::OnAssignButtonClicked);
 	}
 }
 
 void UInventoryItemWidget::SetItemData(const FItemData& Data, int Quantity, APaperChar* Character)
 {
-	ItemData = Data;
+	ItemName = Data.ItemName;
+	ItemType = Data.ItemType;
 	ItemQuantity = Quantity;
 	OwningCharacter = Character;
 
@@ -43,9 +48,18 @@ void UInventoryItemWidget::SetItemData(const FItemData& Data, int Quantity, APap
 		ItemQuantityText->SetText(FText::AsNumber(Quantity));
 	}
 
-	if (ItemIcon && Data.Icon)
+	if (ItemIcon)
 	{
-		ItemIcon->SetBrushFromTexture(Data.Icon);
+		// Recycled rows must not keep the previous item's icon
+		UItemDatabase* DB = UItemDatabase::Get(this);
+		if (UTexture2D* Icon = DB ? DB->GetItemIcon(Data) : Data.Icon.LoadSynchronous())
+		{
+			ItemIcon->SetBrushFromTexture(Icon);
+		}
+		else
+		{
+			ItemIcon->SetBrush(FSlateBrush());
+		}
 	}
 
 	// Show equip button for both Weapons AND Armor
@@ -63,34 +77,45 @@ void UInventoryItemWidget::SetItemData(const FItemData& Data, int Quantity, APap
 	}
 }
 
+void UInventoryItemWidget::NativeOnListItemObjectSet(UObject* ListItemObject)
+{
+	const UInventoryListItem* Item = Cast<UInventoryListItem>(ListItemObject);
+	UItemDatabase* DB = UItemDatabase::Get(this);
+	const FItemData* Data = Item && DB ? DB->GetItemAt(Item->ItemIndex) : nullptr;
+	if (Data)
+	{
+		SetItemData(*Data, Item->Quantity, Item->OwningCharacter.Get());
+	}
+}
+
+void UInventoryItemWidget::SetQuantity(int Quantity)
+{
+	ItemQuantity = Quantity;
+
+	if (ItemQuantityText)
+	{
+		ItemQuantityText->SetText(FText::AsNumber(Quantity));
+	}
+}
+
 void UInventoryItemWidget::OnEquipButtonClicked()
 {
 	if (!OwningCharacter)
 		return;
 
-	if (ItemData.ItemType == EItemType::Weapon)
+	if (ItemType == EItemType::Weapon)
 	{
 		// Find the weapon in inventory and equip it
-		for (int i = 0; i < OwningCharacter->WeaponInventory.Num(); ++i)
+		const int32 WeaponIndex = OwningCharacter->Inventory->FindWeaponIndex(UItemDatabase::Get(this)->FindItemId(ItemName));
+		if (WeaponIndex != INDEX_NONE)
 		{
-			if (OwningCharacter->WeaponInventory[i] == ItemData.ItemName)
-			{
-				OwningCharacter->EquipWeapon(i);
-				break;
-			}
+			OwningCharacter->EquipWeapon(WeaponIndex);
 		}
 	}
-	else if (ItemData.ItemType == EItemType::Armor)
+	else if (ItemType == EItemType::Armor)
 	{
-		// Equip the armor piece
-		OwningCharacter->EquipArmor(ItemData.ItemName);
-
-		// Toggle the inventory so it will update automatically.
-		if (UInventoryWidget* InvWidget = Cast<UInventoryWidget>(GetOuter()))
-		 {
-			 InvWidget->RefreshInventory();
-			 InvWidget->RefreshEquipment();
-		}
+		// Equip the armor piece; the inventory list follows through its delta subscription
+		OwningCharacter->EquipArmor(ItemName);
 	}
 }
 
@@ -99,47 +124,15 @@ void UInventoryItemWidget::OnDeleteButtonClicked()
 	if (!OwningCharacter)
 		return;
 
-	UE_LOG(LogTemp, Warning, TEXT("Delete button clicked for item: %s"), *ItemData.ItemName.ToString());
+	UE_LOG(LogTemp, Warning, TEXT("Delete button clicked for item: %s"), *ItemName.ToString());
 
 	// Try to remove the item from the character.
-	bool bWasRemoved = OwningCharacter->RemoveItem(ItemData.ItemName, 1);
+	bool bWasRemoved = OwningCharacter->RemoveItem(ItemName, 1);
 	
-	if (bWasRemoved)
+	// The row count, its removal at zero and the quick slots all follow the inventory delta
+	if (bWasRemoved && ItemType == EItemType::Weapon)
 	{
-		if (ItemData.ItemType == EItemType::Weapon)
-		{
-			OwningCharacter->UnequipWeapon();
-		}
-
-		// Update the UI to reflect the change
-		int32 NewQuantity = ItemQuantity - 1;
-
-		if (NewQuantity <= 0)
-		{
-			// Try removing from quick slots since the player has none left
-			bool bQuickSlotUpdated = false;
-			for (int i = 0; i < OwningCharacter->QuickSlots.Num(); ++i)
-			{
-				if (OwningCharacter->QuickSlots[i] == ItemData.ItemName)
-				{
-					OwningCharacter->QuickSlots[i] = NAME_None;
-					bQuickSlotUpdated = true;
-				}
-			}
-
-			// If we unassigned a quick slot, refresh that specific UI part
-			if (bQuickSlotUpdated)
-			{
-				OwningCharacter->RefreshQuickSlots();
-			}
-
-			// Eliminate the UI element completely from the inventory list when we reach 0
-			RemoveFromParent();
-		}
-		else
-		{
-			SetItemData(ItemData, NewQuantity, OwningCharacter);
-		}
+		OwningCharacter->UnequipWeapon();
 	}
 }
 
@@ -165,7 +158,7 @@ void UInventoryItemWidget::OnAssignButtonClicked()
 
 	if (ChosenSlot != INDEX_NONE)
 	{
-		OwningCharacter->AssignQuickSlot(ChosenSlot, ItemData.ItemName);
-		UE_LOG(LogTemp, Log, TEXT("Assigned item %s to quick slot %d"), *ItemData.ItemName.ToString(), ChosenSlot + 1);
+		OwningCharacter->AssignQuickSlot(ChosenSlot, ItemName);
+		UE_LOG(LogTemp, Log, TEXT("Assigned item %s to quick slot %d"), *ItemName.ToString(), ChosenSlot + 1);
 	}
 }
\ No newline at end of file
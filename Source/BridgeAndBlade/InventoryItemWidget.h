@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Blueprint/UserWidget.h"
+#include "Blueprint/IUserObjectListEntry.h"
 #include "ItemData.h"
 #include "InventoryItemWidget.generated.h"
 
@@ -13,7 +14,7 @@ class UButton;
 class APaperChar;
 
 UCLASS()
-class BRIDGEANDBLADE_API UInventoryItemWidget : public UUserWidget
+class BRIDGEANDBLADE_API UInventoryItemWidget : public UUserWidget, public IUserObjectListEntry
 {
     GENERATED_BODY()
 
@@ -23,7 +24,13 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Inventory")
     void SetItemData(const FItemData& Data, int Quantity, APaperChar* Character);
 
+    // Update just the count, for rows kept alive across inventory deltas
+    void SetQuantity(int Quantity);
+
 protected:
+    // List view entry: called with a UInventoryListItem whenever this (possibly recycled) row is reused
+    virtual void NativeOnListItemObjectSet(UObject* ListItemObject) override;
+
     UPROPERTY(meta = (BindWidget))
     UTextBlock* ItemNameText;
 
@@ -42,8 +49,9 @@ protected:
     UPROPERTY(meta = (BindWidget))
     UButton* AssignButton;
 
-    UPROPERTY()
-    FItemData ItemData;
+    // Identity of the row's item; the full record stays in UItemDatabase
+    FName ItemName;
+    EItemType ItemType = EItemType::Material;
 
     UPROPERTY()
     APaperChar* OwningCharacter;
@@ -0,0 +1,36 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "InventoryListItem.generated.h"
+
+class APaperChar;
+
+/**
+ * List view model for one item type. UInventoryWidget keeps exactly one per item id for the
+ * lifetime of the widget, so the list views can match entries across refreshes and only
+ * regenerate rows that actually appeared or disappeared.
+ */
+UCLASS()
+class BRIDGEANDBLADE_API UInventoryListItem : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    // Index into UItemDatabase (FItemId::ToIndex)
+    UPROPERTY()
+    int32 ItemIndex = INDEX_NONE;
+
+    // Owned count (inventory pane)
+    UPROPERTY()
+    int32 Quantity = 0;
+
+    // Last known craftable state (crafting pane)
+    UPROPERTY()
+    bool bCraftable = false;
+
+    UPROPERTY()
+    TWeakObjectPtr<APaperChar> OwningCharacter;
+};
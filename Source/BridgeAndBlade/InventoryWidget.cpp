@@ -4,12 +4,16 @@
 #include "InventoryWidget.h"
 #include "Components/Button.h"
 #include "Components/ScrollBox.h"
+#include "Components/ListView.h"
 #include "Components/TextBlock.h"
 #include "Components/Image.h"
 #include "PaperChar.h"
 #include "InventoryItemWidget.h"
 #include "CraftingItemWidget.h"
 #include "ItemDatabase.h"
+#include "InventoryComponent.h"
+#include "InventoryListItem.h"
+#include "Algo/BinarySearch.h"
 
 void UInventoryWidget::NativeConstruct()
 {
@@ -21,9 +25,50 @@ void UInventoryWidget::NativeConstruct()
     }
 }
 
+void UInventoryWidget::NativeDestruct()
+{
+    UnbindInventory();
+
+    Super::NativeDestruct();
+}
+
+void UInventoryWidget::UnbindInventory()
+{
+    if (OwningCharacter && OwningCharacter->Inventory)
+    {
+        OwningCharacter->Inventory->OnInventoryChanged.Remove(InventoryChangedHandle);
+        OwningCharacter->Inventory->OnCraftabilityChanged.Remove(CraftabilityHandle);
+    }
+    InventoryChangedHandle.Reset();
+    CraftabilityHandle.Reset();
+}
+
 void UInventoryWidget::SetOwningCharacter(APaperChar* Character)
 {
+    UnbindInventory();
+
+    // The model objects belong to one character
+    if (Character != OwningCharacter)
+    {
+        ItemObjects.Reset();
+        InventoryModel.Reset();
+        CraftingModel.Reset();
+        InventoryRows.Reset();
+        CraftingRows.Reset();
+
+        if (InventoryListView) InventoryListView->ClearListItems();
+        if (CraftingListView) CraftingListView->ClearListItems();
+        if (InventoryScrollBox) InventoryScrollBox->ClearChildren();
+        if (CraftingScrollBox) CraftingScrollBox->ClearChildren();
+    }
+
     OwningCharacter = Character;
+    if (OwningCharacter && OwningCharacter->Inventory)
+    {
+        InventoryChangedHandle = OwningCharacter->Inventory->OnInventoryChanged.AddUObject(this, &UInventoryWidget::HandleInventoryChanged);
+        CraftabilityHandle = OwningCharacter->Inventory->OnCraftabilityChanged.AddUObject(this, &UInventoryWidget::HandleCraftabilityChanged);
+    }
+
     RefreshInventory();
     RefreshCraftingList();
     RefreshEquipment();
@@ -31,71 +76,244 @@ void UInventoryWidget::SetOwningCharacter(APaperChar* Character)
 
 void UInventoryWidget::RefreshInventory()
 {
-    if (!InventoryScrollBox || !OwningCharacter || !ItemWidgetClass)
+    if (!OwningCharacter || (!InventoryListView && !(InventoryScrollBox && ItemWidgetClass)))
         return;
 
-    // Clear existing items
-    InventoryScrollBox->ClearChildren();
+    const TArray<int32>& Counts = OwningCharacter->Inventory->GetCounts();
+
+    // Diff every item against what is shown; unchanged rows are left alone
+    bool bMembershipChanged = false;
+    const int32 NumItems = FMath::Max(Counts.Num(), ItemObjects.Num());
+    for (int32 Index = 0; Index < NumItems; ++Index)
+    {
+        bMembershipChanged |= SetInventoryCount(Index, Counts.IsValidIndex(Index) ? Counts[Index] : 0);
+    }
+
+    if (bMembershipChanged)
+    {
+        CommitInventoryModel();
+    }
 
-    // Add material inventory
-    for (const auto& Pair : OwningCharacter->MaterialInventory)
+    RefreshEquipment();
+}
+
+UInventoryListItem* UInventoryWidget::GetItemObject(int32 ItemIndex)
+{
+    if (ItemObjects.Num() <= ItemIndex)
     {
-        UInventoryItemWidget* ItemWidget = CreateWidget<UInventoryItemWidget>(this, ItemWidgetClass);
-        if (ItemWidget)
+        ItemObjects.SetNum(ItemIndex + 1);
+    }
+
+    TObjectPtr<UInventoryListItem>& Item = ItemObjects[ItemIndex];
+    if (!Item)
+    {
+        Item = NewObject<UInventoryListItem>(this);
+        Item->ItemIndex = ItemIndex;
+        Item->OwningCharacter = OwningCharacter;
+    }
+    return Item;
+}
+
+bool UInventoryWidget::SetInventoryCount(int32 ItemIndex, int32 Count)
+{
+    Count = FMath::Max(0, Count);
+
+    // Never-owned items don't need a model object
+    if (Count == 0 && !(ItemObjects.IsValidIndex(ItemIndex) && ItemObjects[ItemIndex]))
+        return false;
+
+    UInventoryListItem* Item = GetItemObject(ItemIndex);
+    if (Item->Quantity == Count)
+        return false;
+
+    const bool bWasShown = Item->Quantity > 0;
+    Item->Quantity = Count;
+
+    if (bWasShown && Count > 0)
+    {
+        // Same row, new number
+        if (UInventoryItemWidget* Row = FindInventoryRow(ItemIndex))
         {
-            FItemData ItemData;
-            if (UItemDatabase::Get(this)->GetItemData(Pair.Key, ItemData))
-            {
-                ItemWidget->SetItemData(ItemData, Pair.Value, OwningCharacter);
-                InventoryScrollBox->AddChild(ItemWidget);
-            }
+            Row->SetQuantity(Count);
         }
+        return false;
     }
 
-    // Add weapon inventory
-    TMap<FName, int32> WeaponCounts;
-    for (const FName& WeaponName : OwningCharacter->WeaponInventory)
+    // Keep the model sorted by item index so incremental updates match a full build
+    const int32 Position = Algo::LowerBoundBy(InventoryModel, ItemIndex, [](const UInventoryListItem* Entry) { return Entry->ItemIndex; });
+    if (Count > 0)
     {
-        WeaponCounts.FindOrAdd(WeaponName)++;
+        InventoryModel.Insert(Item, Position);
+    }
+    else
+    {
+        InventoryModel.RemoveAt(Position);
     }
 
-    for (const auto& Pair : WeaponCounts)
+    // The scroll box layout has no virtualization; add / drop the one row directly
+    if (!InventoryListView && InventoryScrollBox)
     {
-        UInventoryItemWidget* ItemWidget = CreateWidget<UInventoryItemWidget>(this, ItemWidgetClass);
-        if (ItemWidget)
+        TWeakObjectPtr<UInventoryItemWidget> Row;
+        InventoryRows.RemoveAndCopyValue(ItemIndex, Row);
+
+        if (Count == 0)
         {
-            FItemData ItemData;
-            if (UItemDatabase::Get(this)->GetItemData(Pair.Key, ItemData))
+            if (Row.IsValid())
             {
-                ItemWidget->SetItemData(ItemData, Pair.Value, OwningCharacter);
-                InventoryScrollBox->AddChild(ItemWidget);
+                Row->RemoveFromParent();
+            }
+        }
+        else if (ItemWidgetClass)
+        {
+            UInventoryItemWidget* ItemWidget = CreateWidget<UInventoryItemWidget>(this, ItemWidgetClass);
+            const FItemData* ItemData = UItemDatabase::Get(this)->GetItemAt(ItemIndex);
+            if (ItemWidget && ItemData)
+            {
+                // Rows follow the model's order, same as a full build
+                ItemWidget->SetItemData(*ItemData, Count, OwningCharacter);
+                InventoryScrollBox->InsertChildAt(Position, ItemWidget);
+                InventoryRows.Add(ItemIndex, ItemWidget);
             }
         }
     }
 
-    
-    RefreshEquipment();
+    return true;
+}
+
+void UInventoryWidget::CommitInventoryModel()
+{
+    if (!InventoryListView)
+        return;
+
+    // Same objects as before, so the list view keeps (and recycles) the rows it already generated
+    TArray<UObject*> Items;
+    Items.Reserve(InventoryModel.Num());
+    for (UInventoryListItem* Item : InventoryModel)
+    {
+        Items.Add(Item);
+    }
+    InventoryListView->SetListItems(Items);
+}
+
+UInventoryItemWidget* UInventoryWidget::FindInventoryRow(int32 ItemIndex) const
+{
+    if (InventoryListView)
+    {
+        UInventoryListItem* Item = ItemObjects.IsValidIndex(ItemIndex) ? ItemObjects[ItemIndex].Get() : nullptr;
+        return Item ? InventoryListView->GetEntryWidgetFromItem<UInventoryItemWidget>(Item) : nullptr;
+    }
+
+    const TWeakObjectPtr<UInventoryItemWidget>* Row = InventoryRows.Find(ItemIndex);
+    return Row ? Row->Get() : nullptr;
+}
+
+UCraftingItemWidget* UInventoryWidget::FindCraftingRow(int32 ItemIndex) const
+{
+    if (CraftingListView)
+    {
+        UInventoryListItem* Item = ItemObjects.IsValidIndex(ItemIndex) ? ItemObjects[ItemIndex].Get() : nullptr;
+        return Item ? CraftingListView->GetEntryWidgetFromItem<UCraftingItemWidget>(Item) : nullptr;
+    }
+
+    const TWeakObjectPtr<UCraftingItemWidget>* Row = CraftingRows.Find(ItemIndex);
+    return Row ? Row->Get() : nullptr;
+}
+
+void UInventoryWidget::HandleInventoryChanged(TArrayView<const FInventoryDelta> Deltas)
+{
+    if (!OwningCharacter)
+        return;
+
+    bool bMembershipChanged = false;
+    for (const FInventoryDelta& Delta : Deltas)
+    {
+        bMembershipChanged |= SetInventoryCount(Delta.ItemId.ToIndex(), Delta.NewCount);
+    }
+
+    if (bMembershipChanged)
+    {
+        CommitInventoryModel();
+    }
 }
 
 void UInventoryWidget::RefreshCraftingList()
 {
-    if (!CraftingScrollBox || !OwningCharacter || !CraftingWidgetClass)
+    if (!OwningCharacter || (!CraftingListView && !(CraftingScrollBox && CraftingWidgetClass)))
         return;
 
-    // Clear existing items
-    CraftingScrollBox->ClearChildren();
+    UItemDatabase* DB = UItemDatabase::Get(this);
+    UInventoryComponent* Inventory = OwningCharacter->Inventory;
 
-    // Get all craftable items
-    TArray<FItemData> CraftableItems = UItemDatabase::Get(this)->GetCraftableItems();
+    // Recipes don't change while the widget is alive, so later refreshes only diff craftability
+    if (CraftingModel.Num() > 0)
+    {
+        for (UInventoryListItem* Item : CraftingModel)
+        {
+            SetRecipeCraftable(Item->ItemIndex, Inventory->CanCraft(FItemId((uint16)Item->ItemIndex)));
+        }
+        return;
+    }
+
+    // Only the recipes, straight from the database's craftable bucket
+    const TArrayView<const FItemId> Recipes = DB->GetCraftableItemIds();
+    CraftingModel.Reserve(Recipes.Num());
+
+    for (FItemId RecipeId : Recipes)
+    {
+        const int32 Index = RecipeId.ToIndex();
+        const FItemData& ItemData = *DB->GetItem(RecipeId);
+
+        UInventoryListItem* Item = GetItemObject(Index);
+        Item->bCraftable = Inventory->CanCraft(RecipeId);
+        CraftingModel.Add(Item);
+
+        if (!CraftingListView)
+        {
+            UCraftingItemWidget* CraftWidget = CreateWidget<UCraftingItemWidget>(this, CraftingWidgetClass);
+            if (CraftWidget)
+            {
+                CraftWidget->SetItemData(ItemData, OwningCharacter, this);
+                CraftingScrollBox->AddChild(CraftWidget);
+                CraftingRows.Add(Index, CraftWidget);
+            }
+        }
+    }
 
-    for (const FItemData& ItemData : CraftableItems)
+    if (CraftingListView)
     {
-        UCraftingItemWidget* CraftWidget = CreateWidget<UCraftingItemWidget>(this, CraftingWidgetClass);
-        if (CraftWidget)
+        TArray<UObject*> Items;
+        Items.Reserve(CraftingModel.Num());
+        for (UInventoryListItem* Item : CraftingModel)
         {
-            CraftWidget->SetItemData(ItemData, OwningCharacter, this);
-            CraftingScrollBox->AddChild(CraftWidget);
+            Items.Add(Item);
         }
+        CraftingListView->SetListItems(Items);
+    }
+}
+
+void UInventoryWidget::SetRecipeCraftable(int32 ItemIndex, bool bCraftable)
+{
+    UInventoryListItem* Item = ItemObjects.IsValidIndex(ItemIndex) ? ItemObjects[ItemIndex].Get() : nullptr;
+    if (!Item || Item->bCraftable == bCraftable)
+        return;
+
+    Item->bCraftable = bCraftable;
+
+    // Rows scrolled out of view pick the state up when they are next generated
+    if (UCraftingItemWidget* Row = FindCraftingRow(ItemIndex))
+    {
+        Row->SetCraftable(bCraftable);
+    }
+}
+
+void UInventoryWidget::HandleCraftabilityChanged(const TArray<FItemId>& Recipes)
+{
+    if (!OwningCharacter)
+        return;
+
+    for (const FItemId& Recipe : Recipes)
+    {
+        SetRecipeCraftable(Recipe.ToIndex(), OwningCharacter->Inventory->IsCraftable(Recipe));
     }
 }
 
@@ -106,13 +324,13 @@ void UInventoryWidget::RefreshEquipment()
     // Update Stats Text
     if (DefenseStatText)
     {
-        FString DefenseString = FString::Printf(TEXT("Defense: %d"), FMath::RoundToInt(OwningCharacter->TotalDefense));
+        FString DefenseString = FString::Printf(TEXT("Defense: %d"), FMath::RoundToInt(OwningCharacter->Attributes->GetValue(EAttribute::Defense)));
         DefenseStatText->SetText(FText::FromString(DefenseString));
     }
 
     if (AttackStatText)
     {
-        FString AttackString = FString::Printf(TEXT("Attack: %d"), FMath::RoundToInt(OwningCharacter->TotalAttack));
+        FString AttackString = FString::Printf(TEXT("Attack: %d"), FMath::RoundToInt(OwningCharacter->Attributes->GetValue(EAttribute::Attack)));
         AttackStatText->SetText(FText::FromString(AttackString));
     }
 
@@ -127,13 +345,13 @@ void UInventoryWidget::RefreshEquipment()
 
         if (OwningCharacter->EquippedArmor.Contains(ArmorSlotId))
         {
-            FName EquippedItemName = OwningCharacter->EquippedArmor[ArmorSlotId];
-            FItemData ItemData;
-            
+            const FItemData* ItemData = DB->FindItem(OwningCharacter->EquippedArmor[ArmorSlotId]);
+
             // If item has a valid texture icon, apply it
-            if (DB->GetItemData(EquippedItemName, ItemData) && ItemData.Icon != nullptr)
+            UTexture2D* Icon = ItemData ? DB->GetItemIcon(*ItemData) : nullptr;
+            if (Icon)
             {
-                SlotImage->SetBrushFromTexture(ItemData.Icon);
+                SlotImage->SetBrushFromTexture(Icon);
                 SlotImage->SetVisibility(ESlateVisibility::Visible); // Show the icon
                 return;
             }
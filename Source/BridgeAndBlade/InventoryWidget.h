@@ -10,11 +10,22 @@
 class UButton;
 class UTextBlock;
 class UScrollBox;
+class UListView;
 class UImage;
 class APaperChar;
+class UCraftingItemWidget;
+class UInventoryItemWidget;
+class UInventoryListItem;
+struct FInventoryDelta;
 
 /*
- * 
+ * Inventory and crafting panes. Each item type has one stable UInventoryListItem; refreshes diff
+ * the owned / craftable model against what is shown and only touch rows that changed.
+ * BP_Inventory binds InventoryScrollBox / CraftingScrollBox, so it keeps one widget per row, added
+ * and dropped as the model changes. A layout that binds InventoryListView / CraftingListView instead
+ * (with BP_InventoryItem / BP_CraftingItem as entry classes) gets virtualized, recycled rows from the
+ * same models; switching BP_Inventory over is a content change still to do. The player creates the widget
+ * on the first open and only hides it on close, so the models and rows last the whole session.
  */
 UCLASS()
 class BRIDGEANDBLADE_API UInventoryWidget : public UUserWidget
@@ -23,6 +34,7 @@ class BRIDGEANDBLADE_API UInventoryWidget : public UUserWidget
 
 public:
     virtual void NativeConstruct() override;
+    virtual void NativeDestruct() override;
 
     // Set the owning player character
     UFUNCTION(BlueprintCallable, Category = "Inventory")
@@ -44,11 +56,17 @@ protected:
     UPROPERTY()
     APaperChar* OwningCharacter;
 
-    // Widget bindings
-    UPROPERTY(meta = (BindWidget))
+    // Widget bindings: a list view (entry class set in the designer) or a scroll box per pane; BP_Inventory uses the scroll boxes
+    UPROPERTY(meta = (BindWidgetOptional))
+    UListView* InventoryListView;
+
+    UPROPERTY(meta = (BindWidgetOptional))
+    UListView* CraftingListView;
+
+    UPROPERTY(meta = (BindWidgetOptional))
     UScrollBox* InventoryScrollBox;
 
-    UPROPERTY(meta = (BindWidget))
+    UPROPERTY(meta = (BindWidgetOptional))
     UScrollBox* CraftingScrollBox;
 
     UPROPERTY(meta = (BindWidget))
@@ -74,15 +92,58 @@ protected:
     UPROPERTY(meta = (BindWidgetOptional))
     class UImage* BootsSlotIcon;
 
-    // Item entry widget class
+    // Item entry widget class (scroll box layout only)
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UI")
     TSubclassOf<class UInventoryItemWidget> ItemWidgetClass;
 
-    // Crafting entry widget class
+    // Crafting entry widget class (scroll box layout only)
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UI") 
     TSubclassOf<class UCraftingItemWidget> CraftingWidgetClass;
 
 
     UFUNCTION()
     void OnCloseButtonClicked();
+
+private:
+    // Add, update or drop just the rows of the items that changed
+    void HandleInventoryChanged(TArrayView<const FInventoryDelta> Deltas);
+
+    // Only the recipes whose state flipped are touched
+    void HandleCraftabilityChanged(const TArray<FItemId>& Recipes);
+
+    void UnbindInventory();
+
+    // Stable model object for an item index, created on first use
+    UInventoryListItem* GetItemObject(int32 ItemIndex);
+
+    // Bring one item's inventory row in line with Count; returns true if the row appeared or went away
+    bool SetInventoryCount(int32 ItemIndex, int32 Count);
+
+    // Push a membership change to the inventory list view (scroll box rows are added / removed directly)
+    void CommitInventoryModel();
+
+    void SetRecipeCraftable(int32 ItemIndex, bool bCraftable);
+
+    // The generated row for an item, if it currently has one
+    UInventoryItemWidget* FindInventoryRow(int32 ItemIndex) const;
+    UCraftingItemWidget* FindCraftingRow(int32 ItemIndex) const;
+
+    // One per item type, indexed by item index
+    UPROPERTY(Transient)
+    TArray<TObjectPtr<UInventoryListItem>> ItemObjects;
+
+    // Owned items, sorted by item index
+    UPROPERTY(Transient)
+    TArray<TObjectPtr<UInventoryListItem>> InventoryModel;
+
+    // Craftable recipes, sorted by item index
+    UPROPERTY(Transient)
+    TArray<TObjectPtr<UInventoryListItem>> CraftingModel;
+
+    // Scroll box layout: rows by item index
+    TMap<int32, TWeakObjectPtr<UInventoryItemWidget>> InventoryRows;
+    TMap<int32, TWeakObjectPtr<UCraftingItemWidget>> CraftingRows;
+
+    FDelegateHandle InventoryChangedHandle;
+    FDelegateHandle CraftabilityHandle;
 };
\ No newline at end of file
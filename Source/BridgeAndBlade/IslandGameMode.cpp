@@ -2,6 +2,13 @@
 
 #include "IslandGameMode.h"
 #include "PaperEnemy.h"
+#include "IslandPreloadSubsystem.h"
+#include "IslandStreamingSubsystem.h"
+#include "IslandWorldState.h"
+#include "ItemDatabase.h"
+#include "SaveGameManager.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
 #include "Kismet/GameplayStatics.h"
 #include "EngineUtils.h"
 #include "Engine/TargetPoint.h"
@@ -18,8 +25,107 @@ void AIslandGameMode::BeginPlay()
 {
     Super::BeginPlay();
 
+    // Usually already in flight from the bridge approach; previous island's assets can go now
+    IslandName = FName(*UGameplayStatics::GetCurrentLevelName(this, true));
+    if (UIslandStreamingSubsystem* Streaming = UIslandStreamingSubsystem::Get(this))
+    {
+        IslandEnteredHandle = Streaming->OnIslandEntered.AddUObject(this, &AIslandGameMode::HandleIslandEntered);
+    }
+    if (UIslandPreloadSubsystem* Preloader = UIslandPreloadSubsystem::Get(this))
+    {
+        Preloader->PreloadIsland(IslandName);
+        Preloader->ReleaseIslandsExcept(IslandName);
+    }
+
+    // The player's save is applied a tick after BeginPlay; harvested props must not respawn before it
+    if (USaveGameManager* SaveManager = USaveGameManager::Get(this))
+    {
+        SaveAppliedHandle = SaveManager->OnSaveApplied.AddUObject(this, &AIslandGameMode::OnSaveApplied);
+    }
+    else
+    {
+        bWorldStateReady = true;
+    }
+
+    TArray<FSoftObjectPath> ClassPaths;
+    for (const TSoftClassPtr<APaperEnemy>& EnemyClass : EnemyClasses)
+    {
+        if (!EnemyClass.IsNull())
+        {
+            ClassPaths.AddUnique(EnemyClass.ToSoftObjectPath());
+        }
+    }
+    for (const TSoftClassPtr<AActor>& EnvClass : EnvironmentActorClasses)
+    {
+        if (!EnvClass.IsNull())
+        {
+            ClassPaths.AddUnique(EnvClass.ToSoftObjectPath());
+        }
+    }
+
+    if (ClassPaths.Num() == 0)
+    {
+        OnSpawnClassesLoaded();
+        return;
+    }
+
+    SpawnClassesHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+        ClassPaths, FStreamableDelegate::CreateUObject(this, &AIslandGameMode::OnSpawnClassesLoaded));
+
+    // No handle means nothing needed streaming and the delegate will not fire
+    if (!SpawnClassesHandle.IsValid())
+    {
+        OnSpawnClassesLoaded();
+    }
+}
+
+void AIslandGameMode::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (USaveGameManager* SaveManager = USaveGameManager::Get(this))
+    {
+        SaveManager->OnSaveApplied.Remove(SaveAppliedHandle);
+    }
+    if (UIslandStreamingSubsystem* Streaming = UIslandStreamingSubsystem::Get(this))
+    {
+        Streaming->OnIslandEntered.Remove(IslandEnteredHandle);
+    }
+
+    // Props torn down with the level were not harvested
+    PropIndices.Reset();
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void AIslandGameMode::OnSpawnClassesLoaded()
+{
+    if (bSpawnClassesReady || !GetWorld())
+    {
+        return;
+    }
+    bSpawnClassesReady = true;
+    StartIsland();
+}
+
+void AIslandGameMode::OnSaveApplied()
+{
+    if (bWorldStateReady)
+    {
+        return;
+    }
+    bWorldStateReady = true;
+    StartIsland();
+}
+
+void AIslandGameMode::StartIsland()
+{
+    if (!bSpawnClassesReady || !bWorldStateReady || !GetWorld())
+    {
+        return;
+    }
+
     // Spawn environment objects once
     SpawnEnvironmentObjects();
+    RestoreSavedObjects();
 
     // Start the repeating spawn timer
     if (SpawnIntervalSeconds > 0.0f && EnemyClasses.Num() > 0)
@@ -28,6 +134,64 @@ void AIslandGameMode::BeginPlay()
     }
 }
 
+void AIslandGameMode::HandleIslandEntered(FName NewIsland, FName PreviousIsland)
+{
+    if (NewIsland == IslandName)
+    {
+        return;
+    }
+
+    if (UIslandPreloadSubsystem* Preloader = UIslandPreloadSubsystem::Get(this))
+    {
+        Preloader->PreloadIsland(NewIsland);
+        Preloader->ReleaseIslandsExcept(NewIsland);
+    }
+
+    // Spawned actors live in the persistent level, so they don't leave with the old island
+    ClearIslandActors();
+    IslandName = NewIsland;
+
+    // Otherwise StartIsland spawns the new island once classes and save are ready
+    if (bSpawnClassesReady && bWorldStateReady)
+    {
+        SpawnEnvironmentObjects();
+        RestoreSavedObjects();
+    }
+}
+
+void AIslandGameMode::ClearIslandActors()
+{
+    // Unbind first; these props were left behind, not harvested
+    for (const TPair<TObjectKey<AActor>, int32>& Prop : PropIndices)
+    {
+        if (AActor* Actor = Prop.Key.ResolveObjectPtr())
+        {
+            Actor->OnDestroyed.RemoveDynamic(this, &AIslandGameMode::HandlePropDestroyed);
+            Actor->Destroy();
+        }
+    }
+    PropIndices.Reset();
+
+    // Still in the island's save; RestoreSavedObjects brings them back on the next visit
+    for (const TWeakObjectPtr<AActor>& Placed : PlacedActors)
+    {
+        if (AActor* Actor = Placed.Get())
+        {
+            Actor->Destroy();
+        }
+    }
+    PlacedActors.Reset();
+
+    for (APaperEnemy* Enemy : SpawnedEnemies)
+    {
+        if (IsValid(Enemy))
+        {
+            Enemy->Destroy();
+        }
+    }
+    SpawnedEnemies.Reset();
+}
+
 void AIslandGameMode::TrySpawnTick()
 {
     if (EnemyClasses.Num() == 0 || !GetWorld())
@@ -67,7 +231,8 @@ void AIslandGameMode::TrySpawnTick()
 
     // Pick random enemy class
     int32 Idx = FMath::RandRange(0, EnemyClasses.Num() - 1);
-    TSubclassOf<APaperEnemy> EnemyClass = EnemyClasses.IsValidIndex(Idx) ? EnemyClasses[Idx] : nullptr;
+    // Classes still streaming are skipped rather than loaded synchronously
+    TSubclassOf<APaperEnemy> EnemyClass = EnemyClasses.IsValidIndex(Idx) ? EnemyClasses[Idx].Get() : nullptr;
     if (!EnemyClass) return;
 
 
@@ -170,16 +335,34 @@ void AIslandGameMode::SpawnEnvironmentObjects()
         return;
     }
 
+    // Same seed, same draws in the same order: prop i is the same object on every visit
+    USaveGameManager* SaveManager = USaveGameManager::Get(this);
+    FRandomStream Stream(SaveManager ? SaveManager->GetIslandSeed(IslandName) : FMath::Rand());
+
+    const UIslandStreamingSubsystem* Streaming = UIslandStreamingSubsystem::Get(this);
+    const FTransform IslandTransform = Streaming ? Streaming->GetIslandTransform(IslandName) : FTransform::Identity;
+
     UNavigationSystemV1* NavSys = UNavigationSystemV1::GetCurrent(GetWorld());
     int32 TotalSpawned = 0;
+    int32 TotalHarvested = 0;
 
     for (int32 i = 0; i < EnvironmentObjectsToSpawn; ++i)
     {
-        // Randomly pick what to spawn
-        TSubclassOf<AActor> EnvClass = EnvironmentActorClasses[FMath::RandRange(0, EnvironmentActorClasses.Num() - 1)];
+        // Draw before any skip so later props keep their draws
+        const int32 ClassIndex = Stream.RandRange(0, EnvironmentActorClasses.Num() - 1);
+        FVector SpawnLocation = IslandTransform.TransformPosition(GetRandomLocationInBounds(Stream, IslandBoundsMin, IslandBoundsMax));
 
-        // Get a random spot within the environment bounds
-        FVector SpawnLocation = GetRandomLocationInBounds(IslandBoundsMin, IslandBoundsMax);
+        if (SaveManager && SaveManager->IsPropHarvested(IslandName, i))
+        {
+            TotalHarvested++;
+            continue;
+        }
+
+        TSubclassOf<AActor> EnvClass = EnvironmentActorClasses[ClassIndex].Get();
+        if (!EnvClass)
+        {
+            continue;
+        }
 
         // Try to snap to navmesh, though not critical for static objects
         if (NavSys)
@@ -201,19 +384,152 @@ void AIslandGameMode::SpawnEnvironmentObjects()
         
         if (SpawnedActor)
         {
+            PropIndices.Add(SpawnedActor, i);
+            SpawnedActor->OnDestroyed.AddDynamic(this, &AIslandGameMode::HandlePropDestroyed);
             TotalSpawned++;
         }
     }
 
-    UE_LOG(LogTemp, Log, TEXT("IslandGameMode: Spawned %d environment objects"), TotalSpawned);
+    UE_LOG(LogTemp, Log, TEXT("IslandGameMode: Spawned %d environment objects (%d harvested)"), TotalSpawned, TotalHarvested);
+}
+
+void AIslandGameMode::HandlePropDestroyed(AActor* DestroyedActor)
+{
+    int32 PropIndex = INDEX_NONE;
+    if (!PropIndices.RemoveAndCopyValue(DestroyedActor, PropIndex))
+    {
+        return;
+    }
+
+    if (USaveGameManager* SaveManager = USaveGameManager::Get(this))
+    {
+        SaveManager->MarkPropHarvested(IslandName, PropIndex);
+    }
+}
+
+AActor* AIslandGameMode::PlaceObject(FName ItemName, const FVector& Location, float Yaw)
+{
+    AActor* Placed = SpawnPlacedObject(ItemName, Location, Yaw);
+    if (!Placed)
+    {
+        return nullptr;
+    }
+
+    // Record where it actually ended up after collision adjustment
+    if (USaveGameManager* SaveManager = USaveGameManager::Get(this))
+    {
+        SaveManager->RegisterPlacedObject(IslandName, ItemName, Placed->GetActorLocation(), Yaw);
+    }
+    return Placed;
+}
+
+AActor* AIslandGameMode::SpawnPlacedObject(FName ItemName, const FVector& Location, float Yaw)
+{
+    const UItemDatabase* ItemDB = UItemDatabase::Get(this);
+    const FItemData* Item = ItemDB ? ItemDB->FindItem(ItemName) : nullptr;
+    if (!Item || Item->PlaceableClass.IsNull())
+    {
+        return nullptr;
+    }
+
+    // Placeables are few and only loaded when one is actually put down or restored
+    UClass* PlaceableClass = Item->PlaceableClass.LoadSynchronous();
+    if (!PlaceableClass)
+    {
+        return nullptr;
+    }
+
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+    AActor* Placed = GetWorld()->SpawnActor<AActor>(PlaceableClass, Location, FRotator(0.0f, Yaw, 0.0f), SpawnParams);
+    if (Placed)
+    {
+        PlacedActors.Add(Placed);
+    }
+    return Placed;
+}
+
+void AIslandGameMode::RestoreSavedObjects()
+{
+    const USaveGameManager* SaveManager = USaveGameManager::Get(this);
+    const FIslandWorldState* State = SaveManager ? SaveManager->FindIslandState(IslandName) : nullptr;
+    if (!State)
+    {
+        return;
+    }
+
+    for (const FPlacedObject& Placed : State->PlacedObjects)
+    {
+        if (!SpawnPlacedObject(Placed.ItemName, Placed.Location, Placed.Yaw))
+        {
+            UE_LOG(LogTemp, Warning, TEXT("IslandGameMode: Saved placeable %s no longer exists"), *Placed.ItemName.ToString());
+        }
+    }
+
+    if (!bPersistEnemies)
+    {
+        return;
+    }
+
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+    for (const FSavedEnemy& Saved : State->Enemies)
+    {
+        TSubclassOf<APaperEnemy> EnemyClass = EnemyClasses.IsValidIndex(Saved.Archetype) ? EnemyClasses[Saved.Archetype].Get() : nullptr;
+        if (!EnemyClass)
+        {
+            continue;
+        }
+
+        APaperEnemy* Enemy = GetWorld()->SpawnActor<APaperEnemy>(EnemyClass, Saved.Location, FRotator::ZeroRotator, SpawnParams);
+        if (Enemy)
+        {
+            Enemy->SpawnDefaultController();
+            Enemy->Attributes->ResetValue(EAttribute::Health, Saved.Health);
+            SpawnedEnemies.Add(Enemy);
+        }
+    }
+}
+
+bool AIslandGameMode::CaptureEnemies(TArray<FSavedEnemy>& OutEnemies) const
+{
+    if (!bPersistEnemies)
+    {
+        return false;
+    }
+
+    for (APaperEnemy* Enemy : SpawnedEnemies)
+    {
+        if (!IsValid(Enemy))
+        {
+            continue;
+        }
+
+        const int32 Archetype = EnemyClasses.IndexOfByPredicate([Enemy](const TSoftClassPtr<APaperEnemy>& EnemyClass)
+        {
+            return EnemyClass.Get() == Enemy->GetClass();
+        });
+        if (Archetype == INDEX_NONE || Archetype > MAX_uint8)
+        {
+            continue;
+        }
+
+        FSavedEnemy& Saved = OutEnemies.AddDefaulted_GetRef();
+        Saved.Archetype = (uint8)Archetype;
+        Saved.Location = Enemy->GetActorLocation();
+        Saved.Health = Enemy->Attributes->GetHealth();
+    }
+    return true;
 }
 
-FVector AIslandGameMode::GetRandomLocationInBounds(const FVector& BoundsMin, const FVector& BoundsMax) const
+FVector AIslandGameMode::GetRandomLocationInBounds(FRandomStream& Stream, const FVector& BoundsMin, const FVector& BoundsMax)
 {
     return FVector(
-        FMath::FRandRange(BoundsMin.X, BoundsMax.X),
-        FMath::FRandRange(BoundsMin.Y, BoundsMax.Y),
-        FMath::FRandRange(BoundsMin.Z, BoundsMax.Z)
+        Stream.FRandRange(BoundsMin.X, BoundsMax.X),
+        Stream.FRandRange(BoundsMin.Y, BoundsMax.Y),
+        Stream.FRandRange(BoundsMin.Z, BoundsMax.Z)
     );
 }
 
@@ -7,6 +7,8 @@
 #include "IslandGameMode.generated.h"
 
 class APaperEnemy;
+struct FStreamableHandle;
+struct FSavedEnemy;
 
 UCLASS()
 class BRIDGEANDBLADE_API AIslandGameMode : public AGameModeBase
@@ -16,12 +18,22 @@ class BRIDGEANDBLADE_API AIslandGameMode : public AGameModeBase
 public:
     AIslandGameMode();
 
+    // Live enemies for the save, when bPersistEnemies is set
+    bool CaptureEnemies(TArray<FSavedEnemy>& OutEnemies) const;
+
+    // Island the player is on (changes without a level load when islands are streamed)
+    FName GetIslandName() const { return IslandName; }
+
+    // Put down a placeable item on the current island and record it in the save. nullptr if it has no class.
+    AActor* PlaceObject(FName ItemName, const FVector& Location, float Yaw);
+
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
-    // Enemy spawning: available enemy classes
+    // Enemy spawning: available enemy classes (streamed in on BeginPlay)
     UPROPERTY(EditDefaultsOnly, Category = "Spawning|Enemies")
-    TArray<TSubclassOf<APaperEnemy>> EnemyClasses;
+    TArray<TSoftClassPtr<APaperEnemy>> EnemyClasses;
 
     // Maximum number of concurrently spawned enemies
     UPROPERTY(EditDefaultsOnly, Category = "Spawning|Enemies")
@@ -42,9 +54,13 @@ protected:
     UPROPERTY(EditAnywhere, Category = "Spawning|Enemies")
     float DespawnRadius = 3000.0f;
 
-    // Environment spawning (unchanged)
+    // Save live enemies with the island and respawn them on load
+    UPROPERTY(EditDefaultsOnly, Category = "Spawning|Enemies")
+    bool bPersistEnemies = false;
+
+    // Environment spawning; bounds are relative to a streamed island's level transform
     UPROPERTY(EditDefaultsOnly, Category = "Spawning|Environment")
-    TArray<TSubclassOf<AActor>> EnvironmentActorClasses;
+    TArray<TSoftClassPtr<AActor>> EnvironmentActorClasses;
 
     UPROPERTY(EditDefaultsOnly, Category = "Spawning|Environment")
     int32 EnvironmentObjectsToSpawn = 20;
@@ -59,6 +75,40 @@ private:
     // Timer for repeated spawning
     FTimerHandle SpawnTimerHandle;
 
+    // Keeps the spawnable classes resident for the life of the island
+    TSharedPtr<FStreamableHandle> SpawnClassesHandle;
+    bool bSpawnClassesReady = false;
+
+    // The island's saved state has been applied (or there was none)
+    bool bWorldStateReady = false;
+    FDelegateHandle SaveAppliedHandle;
+
+    // Environment spawn and the enemy timer wait for the classes to finish streaming and the save to be applied
+    void OnSpawnClassesLoaded();
+    void OnSaveApplied();
+    void StartIsland();
+
+    FName IslandName;
+    FDelegateHandle IslandEnteredHandle;
+
+    // A streamed island became current: swap the previous island's props for this one's
+    void HandleIslandEntered(FName NewIsland, FName PreviousIsland);
+    void ClearIslandActors();
+
+    // Prop index of every environment object still standing
+    TMap<TObjectKey<AActor>, int32> PropIndices;
+
+    UFUNCTION()
+    void HandlePropDestroyed(AActor* DestroyedActor);
+
+    // Objects the player placed and enemies alive at save time
+    void RestoreSavedObjects();
+
+    AActor* SpawnPlacedObject(FName ItemName, const FVector& Location, float Yaw);
+
+    // Placed objects of the current island; they leave with it like the props
+    TArray<TWeakObjectPtr<AActor>> PlacedActors;
+
     // Active spawned enemies tracked here
     UPROPERTY()
     TArray<APaperEnemy*> SpawnedEnemies;
@@ -72,8 +122,8 @@ private:
     // Helper to compute a random point in the ring around the player
     FVector GetRandomPointAroundPlayer(float MinRadius, float MaxRadius) const;
 
-    // Environment spawn (unchanged)
+    // Props are regenerated from the island's seed; harvested ones are skipped
     void SpawnEnvironmentObjects();
 
-    FVector GetRandomLocationInBounds(const FVector& BoundsMin, const FVector& BoundsMax) const;
+    static FVector GetRandomLocationInBounds(FRandomStream& Stream, const FVector& BoundsMin, const FVector& BoundsMax);
 };
@@ -0,0 +1,16 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "IslandPreloadManifest.h"
+#include "PaperEnemy.h"
+#include "WeaponBase.h"
+#include "PaperFlipbook.h"
+#include "PaperSprite.h"
+
+const FPrimaryAssetType UIslandPreloadManifest::PrimaryAssetType(TEXT("IslandPreload"));
+const FName UIslandPreloadManifest::IslandBundle(TEXT("Island"));
+
+FPrimaryAssetId UIslandPreloadManifest::GetPrimaryAssetId() const
+{
+    // Asset name doubles as the island level name
+    return FPrimaryAssetId(PrimaryAssetType, GetFName());
+}
@@ -0,0 +1,49 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "IslandPreloadManifest.generated.h"
+
+class APaperEnemy;
+class AWeaponBase;
+class UPaperFlipbook;
+class UPaperSprite;
+
+/**
+ * Everything an island needs resident before gameplay spawns it. One manifest per island level,
+ * named after the level (e.g. Island_02) and placed under /Game/Preload so the Asset Manager
+ * finds it as an "IslandPreload" primary asset. All references are soft and tagged with the
+ * "Island" bundle, so loading the bundle streams the classes and their flipbooks asynchronously.
+ */
+UCLASS(BlueprintType)
+class BRIDGEANDBLADE_API UIslandPreloadManifest : public UPrimaryDataAsset
+{
+    GENERATED_BODY()
+
+public:
+    static const FPrimaryAssetType PrimaryAssetType;
+    static const FName IslandBundle;
+
+    virtual FPrimaryAssetId GetPrimaryAssetId() const override;
+
+    // Enemy blueprints spawned on this island
+    UPROPERTY(EditDefaultsOnly, Category = "Preload", meta = (AssetBundles = "Island"))
+    TArray<TSoftClassPtr<APaperEnemy>> EnemyClasses;
+
+    // Environment props spawned on this island
+    UPROPERTY(EditDefaultsOnly, Category = "Preload", meta = (AssetBundles = "Island"))
+    TArray<TSoftClassPtr<AActor>> EnvironmentClasses;
+
+    // Weapons likely to be crafted or dropped here (every DT_Items weapon is preloaded separately)
+    UPROPERTY(EditDefaultsOnly, Category = "Preload", meta = (AssetBundles = "Island"))
+    TArray<TSoftClassPtr<AWeaponBase>> WeaponClasses;
+
+    // Extra flipbooks / sprites not reachable from the classes above
+    UPROPERTY(EditDefaultsOnly, Category = "Preload", meta = (AssetBundles = "Island"))
+    TArray<TSoftObjectPtr<UPaperFlipbook>> Flipbooks;
+
+    UPROPERTY(EditDefaultsOnly, Category = "Preload", meta = (AssetBundles = "Island"))
+    TArray<TSoftObjectPtr<UPaperSprite>> Sprites;
+};
@@ -0,0 +1,296 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "IslandPreloadSubsystem.h"
+#include "IslandPreloadManifest.h"
+#include "ItemDatabase.h"
+#include "WeaponBase.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "HAL/PlatformTime.h"
+#include "UObject/UObjectGlobals.h"
+#include "Kismet/GameplayStatics.h"
+
+DECLARE_STATS_GROUP(TEXT("IslandPreload"), STATGROUP_IslandPreload, STATCAT_Advanced);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Preloads Started"), STAT_IslandPreloadStarted, STATGROUP_IslandPreload);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Preloads Cancelled"), STAT_IslandPreloadCancelled, STATGROUP_IslandPreload);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Travel Hits"), STAT_IslandPreloadHits, STATGROUP_IslandPreload);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Travel Partial"), STAT_IslandPreloadPartial, STATGROUP_IslandPreload);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Travel Misses"), STAT_IslandPreloadMisses, STATGROUP_IslandPreload);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Hit Rate (%)"), STAT_IslandPreloadHitRate, STATGROUP_IslandPreload);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Latency Saved (ms)"), STAT_IslandPreloadLatencySaved, STATGROUP_IslandPreload);
+
+void UIslandPreloadSubsystem::Deinitialize()
+{
+    for (TPair<FName, FIslandPreload>& Pair : Islands)
+    {
+        Release(Pair.Value);
+    }
+    Islands.Empty();
+    PreloadedLevels.Empty();
+
+    if (WeaponHandle.IsValid())
+    {
+        WeaponHandle->ReleaseHandle();
+        WeaponHandle.Reset();
+    }
+
+    Super::Deinitialize();
+}
+
+UIslandPreloadSubsystem* UIslandPreloadSubsystem::Get(const UObject* WorldContextObject)
+{
+    UGameInstance* GameInstance = UGameplayStatics::GetGameInstance(WorldContextObject);
+    return GameInstance ? GameInstance->GetSubsystem<UIslandPreloadSubsystem>() : nullptr;
+}
+
+bool UIslandPreloadSubsystem::PreloadIsland(FName LevelName, bool bIncludeLevel)
+{
+    if (LevelName.IsNone())
+        return false;
+
+    const bool bNew = !Islands.Contains(LevelName);
+    FIslandPreload& Preload = Islands.FindOrAdd(LevelName);
+    if (bNew)
+    {
+        Preload.StartTime = FPlatformTime::Seconds();
+    }
+
+    // Manifest bundle, unless already streaming or resident
+    if (!Preload.Handle.IsValid() || Preload.Handle->WasCanceled())
+    {
+        UAssetManager* AssetManager = UAssetManager::GetIfInitialized();
+        const FPrimaryAssetId ManifestId(UIslandPreloadManifest::PrimaryAssetType, LevelName);
+        if (AssetManager && AssetManager->GetPrimaryAssetPath(ManifestId).IsValid())
+        {
+            // No handle means nothing needed streaming (already in memory)
+            Preload.Handle = AssetManager->LoadPrimaryAsset(ManifestId, { UIslandPreloadManifest::IslandBundle },
+                FStreamableManager::DefaultAsyncLoadPriority,
+                FStreamableDelegate::CreateUObject(this, &UIslandPreloadSubsystem::UpdateCompletion, LevelName));
+            if (Preload.Handle.IsValid())
+            {
+                UE_LOG(LogTemp, Log, TEXT("IslandPreload: streaming assets for %s"), *LevelName.ToString());
+            }
+        }
+        else
+        {
+            UE_LOG(LogTemp, Verbose, TEXT("IslandPreload: no manifest for %s"), *LevelName.ToString());
+        }
+    }
+
+    if (bIncludeLevel && Preload.LevelPackage.IsNone() && LevelName != CurrentIsland)
+    {
+        RequestLevelPackage(LevelName, Preload);
+    }
+
+    if (!Preload.Handle.IsValid() && Preload.LevelPackage.IsNone())
+    {
+        Islands.Remove(LevelName);
+        return false;
+    }
+
+    if (bNew)
+    {
+        INC_DWORD_STAT(STAT_IslandPreloadStarted);
+    }
+    UpdateCompletion(LevelName);
+    return true;
+}
+
+FName UIslandPreloadSubsystem::FindLevelPackage(FName LevelName)
+{
+    if (!bLevelPackagesScanned)
+    {
+        bLevelPackagesScanned = true;
+
+        TArray<FAssetData> Maps;
+        UAssetManager::Get().GetAssetRegistry().GetAssetsByClass(UWorld::StaticClass()->GetClassPathName(), Maps);
+        for (const FAssetData& Map : Maps)
+        {
+            LevelPackages.Add(Map.AssetName, Map.PackageName);
+        }
+    }
+
+    const FName* PackageName = LevelPackages.Find(LevelName);
+    return PackageName ? *PackageName : NAME_None;
+}
+
+void UIslandPreloadSubsystem::RequestLevelPackage(FName LevelName, FIslandPreload& Preload)
+{
+    const FName PackageName = FindLevelPackage(LevelName);
+    if (PackageName.IsNone())
+        return;
+
+    Preload.LevelPackage = PackageName;
+    Preload.bLevelLoaded = false;
+
+    TWeakObjectPtr<UIslandPreloadSubsystem> WeakThis(this);
+    LoadPackageAsync(PackageName.ToString(), FLoadPackageAsyncDelegate::CreateLambda(
+        [WeakThis, LevelName](const FName& LoadedName, UPackage* Package, EAsyncLoadingResult::Type Result)
+        {
+            if (UIslandPreloadSubsystem* This = WeakThis.Get())
+            {
+                This->OnLevelPackageLoaded(LevelName, LoadedName, Result == EAsyncLoadingResult::Succeeded ? Package : nullptr);
+            }
+        }));
+}
+
+void UIslandPreloadSubsystem::OnLevelPackageLoaded(FName LevelName, FName PackageName, UPackage* Package)
+{
+    // Async package loads can't be cancelled; a cancelled or re-requested preload just ignores the result
+    FIslandPreload* Preload = Islands.Find(LevelName);
+    if (!Preload || Preload->LevelPackage != PackageName)
+        return;
+
+    Preload->bLevelLoaded = true;
+    if (UWorld* World = Package ? UWorld::FindWorldInPackage(Package) : nullptr)
+    {
+        PreloadedLevels.Add(LevelName, World);
+    }
+    else
+    {
+        UE_LOG(LogTemp, Warning, TEXT("IslandPreload: could not load map package %s"), *PackageName.ToString());
+    }
+
+    UpdateCompletion(LevelName);
+}
+
+void UIslandPreloadSubsystem::UpdateCompletion(FName LevelName)
+{
+    FIslandPreload* Preload = Islands.Find(LevelName);
+    if (!Preload || Preload->CompleteTime > 0.0 || !IsIslandLoaded(LevelName))
+        return;
+
+    Preload->CompleteTime = FPlatformTime::Seconds();
+    UE_LOG(LogTemp, Log, TEXT("IslandPreload: %s ready after %.0f ms"), *LevelName.ToString(), (Preload->CompleteTime - Preload->StartTime) * 1000.0);
+}
+
+void UIslandPreloadSubsystem::Release(FIslandPreload& Preload)
+{
+    if (Preload.Handle.IsValid())
+    {
+        // Cancel stops an unfinished stream; release drops a finished one
+        if (Preload.Handle->IsLoadingInProgress())
+        {
+            Preload.Handle->CancelHandle();
+        }
+        else
+        {
+            Preload.Handle->ReleaseHandle();
+        }
+        Preload.Handle.Reset();
+    }
+}
+
+void UIslandPreloadSubsystem::CancelIsland(FName LevelName)
+{
+    if (LevelName == CurrentIsland)
+        return;
+
+    FIslandPreload Preload;
+    if (!Islands.RemoveAndCopyValue(LevelName, Preload))
+        return;
+
+    Release(Preload);
+    PreloadedLevels.Remove(LevelName);
+
+    INC_DWORD_STAT(STAT_IslandPreloadCancelled);
+    UE_LOG(LogTemp, Log, TEXT("IslandPreload: cancelled %s"), *LevelName.ToString());
+}
+
+void UIslandPreloadSubsystem::ReleaseIslandsExcept(FName LevelName)
+{
+    CurrentIsland = LevelName;
+
+    for (auto It = Islands.CreateIterator(); It; ++It)
+    {
+        if (It.Key() == LevelName)
+            continue;
+
+        Release(It.Value());
+        It.RemoveCurrent();
+    }
+
+    // The current map is the live world now, and a reference held past the next travel would leak it
+    PreloadedLevels.Empty();
+    if (FIslandPreload* Current = Islands.Find(LevelName))
+    {
+        Current->LevelPackage = NAME_None;
+    }
+}
+
+bool UIslandPreloadSubsystem::IsIslandLoaded(FName LevelName) const
+{
+    const FIslandPreload* Preload = Islands.Find(LevelName);
+    if (!Preload)
+        return false;
+
+    const bool bAssetsLoaded = !Preload->Handle.IsValid() || Preload->Handle->HasLoadCompleted();
+    const bool bLevelLoaded = Preload->LevelPackage.IsNone() || Preload->bLevelLoaded;
+    return bAssetsLoaded && bLevelLoaded;
+}
+
+void UIslandPreloadSubsystem::NotifyTravel(FName LevelName)
+{
+    const FIslandPreload* Preload = Islands.Find(LevelName);
+    const double Now = FPlatformTime::Seconds();
+
+    // Time already spent loading is time the travel doesn't have to spend
+    double SavedMs = 0.0;
+    const TCHAR* Outcome = TEXT("miss");
+    if (!Preload)
+    {
+        ++TravelMisses;
+        INC_DWORD_STAT(STAT_IslandPreloadMisses);
+    }
+    else if (IsIslandLoaded(LevelName))
+    {
+        ++TravelHits;
+        INC_DWORD_STAT(STAT_IslandPreloadHits);
+        SavedMs = ((Preload->CompleteTime > 0.0 ? Preload->CompleteTime : Now) - Preload->StartTime) * 1000.0;
+        Outcome = TEXT("hit");
+    }
+    else
+    {
+        ++TravelPartial;
+        INC_DWORD_STAT(STAT_IslandPreloadPartial);
+        SavedMs = (Now - Preload->StartTime) * 1000.0;
+        Outcome = TEXT("partial");
+    }
+
+    LatencySavedMs += SavedMs;
+    const int32 Travels = TravelHits + TravelPartial + TravelMisses;
+    const float HitRate = 100.0f * TravelHits / Travels;
+    SET_FLOAT_STAT(STAT_IslandPreloadHitRate, HitRate);
+    SET_FLOAT_STAT(STAT_IslandPreloadLatencySaved, (float)LatencySavedMs);
+
+    UE_LOG(LogTemp, Log, TEXT("IslandPreload: travel to %s was a %s, saved ~%.0f ms (hit rate %.0f%% over %d travels)"),
+        *LevelName.ToString(), Outcome, SavedMs, HitRate, Travels);
+}
+
+void UIslandPreloadSubsystem::PreloadItemWeapons()
+{
+    if (WeaponHandle.IsValid())
+        return;
+
+    UItemDatabase* DB = UItemDatabase::Get(this);
+    if (!DB)
+        return;
+
+    TArray<FSoftObjectPath> Paths;
+    for (FItemId Id : DB->GetItemIdsOfType(EItemType::Weapon))
+    {
+        const FItemData* Item = DB->GetItem(Id);
+        if (!Item->WeaponClass.IsNull())
+        {
+            Paths.AddUnique(Item->WeaponClass.ToSoftObjectPath());
+        }
+    }
+
+    if (Paths.Num() > 0)
+    {
+        WeaponHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(Paths, FStreamableDelegate(), FStreamableManager::AsyncLoadHighPriority);
+    }
+}
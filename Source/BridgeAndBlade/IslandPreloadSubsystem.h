@@ -0,0 +1,93 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "IslandPreloadSubsystem.generated.h"
+
+struct FStreamableHandle;
+
+/**
+ * Streams island assets in the background so spawning never hits a synchronous load.
+ * Islands are preloaded through their UIslandPreloadManifest ("Island" bundle) when the level
+ * starts and again for the destination when the player walks up to a bridge. Handles live on
+ * the game instance so they survive the level transition; islands that are neither current nor
+ * pending are released when the next island begins play.
+ *
+ * Bridge preloads also load the destination's map package, which OpenLevel then finds in memory.
+ * They can be cancelled when the player walks away, and every travel is scored as a hit (all
+ * loaded), partial or miss under "stat IslandPreload", with the load time it saved.
+ */
+UCLASS()
+class BRIDGEANDBLADE_API UIslandPreloadSubsystem : public UGameInstanceSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Deinitialize() override;
+
+    static UIslandPreloadSubsystem* Get(const UObject* WorldContextObject);
+
+    // Start streaming the manifest for LevelName, and with bIncludeLevel its map package.
+    // Returns false if there was nothing to preload.
+    bool PreloadIsland(FName LevelName, bool bIncludeLevel = false);
+
+    // Player turned back: drop LevelName's preload unless it is the current island
+    void CancelIsland(FName LevelName);
+
+    // Drop every island handle except LevelName (called once an island has begun play)
+    void ReleaseIslandsExcept(FName LevelName);
+
+    // Manifest and (if requested) map package are both in memory
+    bool IsIslandLoaded(FName LevelName) const;
+
+    // Travel to LevelName is committing now; scores the preload for the stats
+    void NotifyTravel(FName LevelName);
+
+    // Keep every weapon class in the item database resident (weapons follow the player between islands)
+    void PreloadItemWeapons();
+
+private:
+    struct FIslandPreload
+    {
+        TSharedPtr<FStreamableHandle> Handle;
+
+        // Map package, if requested and found
+        FName LevelPackage;
+        bool bLevelLoaded = false;
+
+        double StartTime = 0.0;
+        double CompleteTime = 0.0;
+    };
+
+    // Long package name of the map called LevelName, NAME_None if there is none
+    FName FindLevelPackage(FName LevelName);
+
+    void RequestLevelPackage(FName LevelName, FIslandPreload& Preload);
+    void OnLevelPackageLoaded(FName LevelName, FName PackageName, UPackage* Package);
+
+    // Stamp CompleteTime once everything LevelName asked for is in
+    void UpdateCompletion(FName LevelName);
+
+    void Release(FIslandPreload& Preload);
+
+    TMap<FName, FIslandPreload> Islands;
+
+    // Preloaded maps, held until their travel has happened (or was cancelled)
+    UPROPERTY()
+    TMap<FName, TObjectPtr<UWorld>> PreloadedLevels;
+
+    // Short map name -> long package name, from the asset registry
+    TMap<FName, FName> LevelPackages;
+    bool bLevelPackagesScanned = false;
+
+    FName CurrentIsland;
+
+    TSharedPtr<FStreamableHandle> WeaponHandle;
+
+    int32 TravelHits = 0;
+    int32 TravelPartial = 0;
+    int32 TravelMisses = 0;
+    double LatencySavedMs = 0.0;
+};
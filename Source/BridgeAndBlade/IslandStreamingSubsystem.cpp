@@ -0,0 +1,107 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "IslandStreamingSubsystem.h"
+#include "Engine/LevelStreaming.h"
+#include "Engine/World.h"
+#include "Kismet/GameplayStatics.h"
+#include "TimerManager.h"
+
+bool UIslandStreamingSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UIslandStreamingSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    PersistentIsland = FName(*UGameplayStatics::GetCurrentLevelName(&InWorld, true));
+    CurrentIsland = PersistentIsland;
+}
+
+UIslandStreamingSubsystem* UIslandStreamingSubsystem::Get(const UObject* WorldContextObject)
+{
+    UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    return World ? World->GetSubsystem<UIslandStreamingSubsystem>() : nullptr;
+}
+
+ULevelStreaming* UIslandStreamingSubsystem::FindStreamingLevel(FName IslandName) const
+{
+    // Matches the short package name and handles the PIE prefix
+    return IslandName.IsNone() ? nullptr : UGameplayStatics::GetStreamingLevel(GetWorld(), IslandName);
+}
+
+bool UIslandStreamingSubsystem::CanStream(FName IslandName) const
+{
+    return IslandName == PersistentIsland || FindStreamingLevel(IslandName) != nullptr;
+}
+
+bool UIslandStreamingSubsystem::StreamIn(FName IslandName, bool bBlock)
+{
+    if (IslandName == PersistentIsland)
+        return true;
+
+    ULevelStreaming* StreamingLevel = FindStreamingLevel(IslandName);
+    if (!StreamingLevel)
+        return false;
+
+    StreamingLevel->bShouldBlockOnLoad = bBlock;
+    StreamingLevel->SetShouldBeLoaded(true);
+    StreamingLevel->SetShouldBeVisible(true);
+
+    if (bBlock)
+    {
+        GetWorld()->FlushLevelStreaming();
+    }
+    return true;
+}
+
+bool UIslandStreamingSubsystem::IsIslandVisible(FName IslandName) const
+{
+    if (IslandName == PersistentIsland)
+        return true;
+
+    const ULevelStreaming* StreamingLevel = FindStreamingLevel(IslandName);
+    return StreamingLevel && StreamingLevel->IsLevelVisible();
+}
+
+void UIslandStreamingSubsystem::EnterIsland(FName IslandName)
+{
+    if (IslandName == CurrentIsland || !CanStream(IslandName))
+        return;
+
+    const FName PreviousIsland = CurrentIsland;
+    CurrentIsland = IslandName;
+
+    UE_LOG(LogTemp, Log, TEXT("IslandStreaming: entered %s from %s"), *IslandName.ToString(), *PreviousIsland.ToString());
+    OnIslandEntered.Broadcast(IslandName, PreviousIsland);
+
+    // The bridge that got us here usually lives in the previous island
+    TWeakObjectPtr<UIslandStreamingSubsystem> WeakThis(this);
+    GetWorld()->GetTimerManager().SetTimerForNextTick([WeakThis, PreviousIsland]()
+    {
+        if (UIslandStreamingSubsystem* This = WeakThis.Get())
+        {
+            This->StreamOut(PreviousIsland);
+        }
+    });
+}
+
+void UIslandStreamingSubsystem::StreamOut(FName IslandName)
+{
+    // The persistent level can't be unloaded, and the player may already have walked back
+    if (IslandName == PersistentIsland || IslandName == CurrentIsland)
+        return;
+
+    if (ULevelStreaming* StreamingLevel = FindStreamingLevel(IslandName))
+    {
+        StreamingLevel->SetShouldBeVisible(false);
+        StreamingLevel->SetShouldBeLoaded(false);
+    }
+}
+
+FTransform UIslandStreamingSubsystem::GetIslandTransform(FName IslandName) const
+{
+    const ULevelStreaming* StreamingLevel = FindStreamingLevel(IslandName);
+    return StreamingLevel ? StreamingLevel->LevelTransform : FTransform::Identity;
+}
@@ -0,0 +1,61 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "IslandStreamingSubsystem.generated.h"
+
+class ULevelStreaming;
+
+// The player moved onto another island without a level change
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnIslandEntered, FName /*IslandName*/, FName /*PreviousIsland*/);
+
+/**
+ * Islands hosted as streaming sublevels of one persistent world. A sublevel (Blueprint streaming
+ * method, placed with its level transform) is addressed by its short package name, the same name
+ * ABridgeZone::DestinationLevelName uses for OpenLevel, so a destination that is not a sublevel
+ * of the current world simply isn't streamable and the bridge falls back to OpenLevel.
+ *
+ * The current island starts as the persistent level itself. EnterIsland makes another one
+ * current and streams the previous one out on the next tick, so the caller (often an actor in
+ * the previous island) is never unloaded under its own feet.
+ */
+UCLASS()
+class BRIDGEANDBLADE_API UIslandStreamingSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+    static UIslandStreamingSubsystem* Get(const UObject* WorldContextObject);
+
+    // Whether IslandName is a streaming sublevel of this world
+    bool CanStream(FName IslandName) const;
+
+    // Start loading IslandName in the background and show it once loaded. bBlock waits for it (save loads only).
+    bool StreamIn(FName IslandName, bool bBlock = false);
+
+    bool IsIslandVisible(FName IslandName) const;
+
+    // nullptr if IslandName is not a sublevel
+    ULevelStreaming* FindStreamingLevel(FName IslandName) const;
+
+    // Make IslandName current and stream the previous island out (unless it is the persistent level)
+    void EnterIsland(FName IslandName);
+
+    FName GetCurrentIsland() const { return CurrentIsland; }
+
+    // Level transform of IslandName's sublevel; identity for the persistent level
+    FTransform GetIslandTransform(FName IslandName) const;
+
+    FOnIslandEntered OnIslandEntered;
+
+private:
+    void StreamOut(FName IslandName);
+
+    FName PersistentIsland;
+    FName CurrentIsland;
+};
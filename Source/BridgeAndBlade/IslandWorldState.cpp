@@ -0,0 +1,36 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "IslandWorldState.h"
+
+bool FIslandWorldState::IsHarvested(int32 PropIndex) const
+{
+    const int32 ChunkIndex = ChunkOf(PropIndex);
+    return PropIndex >= 0 && HarvestedChunks.IsValidIndex(ChunkIndex)
+        && (HarvestedChunks[ChunkIndex] & (1ull << (PropIndex % PropsPerChunk))) != 0;
+}
+
+int32 FIslandWorldState::SetHarvested(int32 PropIndex)
+{
+    const int32 ChunkIndex = ChunkOf(PropIndex);
+    if (PropIndex < 0 || ChunkIndex >= MaxChunks || IsHarvested(PropIndex))
+        return INDEX_NONE;
+
+    if (ChunkIndex >= HarvestedChunks.Num())
+    {
+        HarvestedChunks.SetNumZeroed(ChunkIndex + 1);
+    }
+    HarvestedChunks[ChunkIndex] |= 1ull << (PropIndex % PropsPerChunk);
+    return ChunkIndex;
+}
+
+void FIslandWorldState::SetChunk(int32 ChunkIndex, uint64 Bits)
+{
+    if (ChunkIndex < 0 || ChunkIndex >= MaxChunks)
+        return;
+
+    if (ChunkIndex >= HarvestedChunks.Num())
+    {
+        HarvestedChunks.SetNumZeroed(ChunkIndex + 1);
+    }
+    HarvestedChunks[ChunkIndex] = Bits;
+}
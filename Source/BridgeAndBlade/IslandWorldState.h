@@ -0,0 +1,52 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// An item the player put down on an island
+struct FPlacedObject
+{
+    FName ItemName;
+    FVector Location = FVector::ZeroVector;
+    float Yaw = 0.0f;
+};
+
+// A live enemy at save time; Archetype indexes AIslandGameMode::EnemyClasses
+struct FSavedEnemy
+{
+    uint8 Archetype = 0;
+    FVector Location = FVector::ZeroVector;
+    int32 Health = 0;
+};
+
+/**
+ * What the player changed on one island. The props themselves are not stored: the island
+ * regenerates them from Seed, and HarvestedChunks marks the prop indices that are gone, 64 per
+ * chunk, so one harvest only ever rewrites one chunk. Placed objects and (optionally) enemies are
+ * short lists kept as-is.
+ */
+struct BRIDGEANDBLADE_API FIslandWorldState
+{
+    static constexpr int32 PropsPerChunk = 64;
+
+    // Far beyond any island; keeps a corrupt index from allocating gigabytes
+    static constexpr int32 MaxChunks = 64 * 1024;
+
+    // 0 until the island is first visited
+    int32 Seed = 0;
+
+    TArray<uint64> HarvestedChunks;
+    TArray<FPlacedObject> PlacedObjects;
+    TArray<FSavedEnemy> Enemies;
+
+    bool IsHarvested(int32 PropIndex) const;
+
+    // Returns the chunk that changed, INDEX_NONE if the prop was already harvested
+    int32 SetHarvested(int32 PropIndex);
+
+    // Overwrite one chunk (journal replay)
+    void SetChunk(int32 ChunkIndex, uint64 Bits);
+
+    static int32 ChunkOf(int32 PropIndex) { return PropIndex / PropsPerChunk; }
+};
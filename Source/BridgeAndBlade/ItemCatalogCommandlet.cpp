@@ -0,0 +1,148 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "ItemCatalogCommandlet.h"
+#include "ItemDatabase.h"
+#include "Engine/DataTable.h"
+#include "HAL/FileManager.h"
+#include "UObject/ObjectSaveContext.h"
+#include "UObject/UObjectGlobals.h"
+
+UItemCatalogCommandlet::UItemCatalogCommandlet()
+{
+    IsClient = false;
+    IsServer = false;
+    IsEditor = true;
+    LogToConsole = true;
+}
+
+int32 UItemCatalogCommandlet::Main(const FString& Params)
+{
+    FString TablePath = TEXT("/Game/DT_Items.DT_Items");
+    FParse::Value(*Params, TEXT("Table="), TablePath);
+
+    FString OutputPath = UItemDatabase::GetDefaultCatalogPath();
+    FParse::Value(*Params, TEXT("Output="), OutputPath);
+
+    UDataTable* Table = LoadObject<UDataTable>(nullptr, *TablePath);
+    if (!Table || Table->GetRowStruct() != FItemData::StaticStruct())
+    {
+        UE_LOG(LogTemp, Error, TEXT("ItemCatalog: %s is not an FItemData table"), *TablePath);
+        return 1;
+    }
+
+    return BakeCatalog(*Table, OutputPath) ? 0 : 1;
+}
+
+bool UItemCatalogCommandlet::BakeCatalog(UDataTable& Table, const FString& OutputPath)
+{
+    const int32 NumErrors = ValidateTable(Table);
+    if (NumErrors > 0)
+    {
+        // A stale catalog would still win over the table in packaged builds; without one they use the table
+        IFileManager::Get().Delete(*OutputPath, /*RequireExists*/ false, /*EvenReadOnly*/ true, /*Quiet*/ true);
+        UE_LOG(LogTemp, Error, TEXT("ItemCatalog: %s has %d error(s), catalog not written"), *Table.GetPathName(), NumErrors);
+        return false;
+    }
+
+    // A private database, so the baked tables come from exactly the code the game runs
+    UItemDatabase* Database = NewObject<UItemDatabase>();
+    Database->InitializeFromTable(&Table);
+
+    // Same contents as the file already there: leave it (and its timestamp) alone
+    uint32 ExistingHash = 0;
+    if (UItemDatabase::ReadCatalogSourceHash(OutputPath, ExistingHash) && ExistingHash == Database->ComputeSourceHash())
+    {
+        UE_LOG(LogTemp, Log, TEXT("ItemCatalog: %s is up to date"), *OutputPath);
+        return true;
+    }
+
+    return Database->SaveCatalog(OutputPath);
+}
+
+#if WITH_EDITOR
+void UItemCatalogCommandlet::RegisterCookHook()
+{
+    FCoreUObjectDelegates::OnObjectPreSave.AddStatic(&UItemCatalogCommandlet::HandleObjectPreSave);
+}
+
+void UItemCatalogCommandlet::HandleObjectPreSave(UObject* Object, FObjectPreSaveContext SaveContext)
+{
+    // Every cook of an item table rebakes the catalog, so packaged builds never stage one from an older table
+    UDataTable* Table = Cast<UDataTable>(Object);
+    if (!SaveContext.IsCooking() || !Table || Table->GetRowStruct() != FItemData::StaticStruct())
+        return;
+
+    BakeCatalog(*Table, UItemDatabase::GetDefaultCatalogPath());
+}
+#endif
+
+int32 UItemCatalogCommandlet::ValidateTable(const UDataTable& Table)
+{
+    int32 NumErrors = 0;
+
+    // Same naming rule as UItemDatabase::CacheItemData
+    TSet<FName> Names;
+    for (const TPair<FName, uint8*>& Row : Table.GetRowMap())
+    {
+        const FItemData* Item = reinterpret_cast<const FItemData*>(Row.Value);
+        const FName ItemName = Item->ItemName.IsNone() ? Row.Key : Item->ItemName;
+
+        bool bDuplicate = false;
+        Names.Add(ItemName, &bDuplicate);
+        if (bDuplicate)
+        {
+            UE_LOG(LogTemp, Error, TEXT("ItemCatalog: item '%s' is defined more than once"), *ItemName.ToString());
+            ++NumErrors;
+        }
+    }
+
+    if (Names.Num() >= FItemId::InvalidValue)
+    {
+        UE_LOG(LogTemp, Error, TEXT("ItemCatalog: %d items, ids only go up to %d"), Names.Num(), FItemId::InvalidValue - 1);
+        ++NumErrors;
+    }
+
+    for (const TPair<FName, uint8*>& Row : Table.GetRowMap())
+    {
+        const FItemData* Item = reinterpret_cast<const FItemData*>(Row.Value);
+        const FString ItemName = (Item->ItemName.IsNone() ? Row.Key : Item->ItemName).ToString();
+
+        if (Item->MaxStackSize <= 0)
+        {
+            UE_LOG(LogTemp, Error, TEXT("ItemCatalog: '%s' has MaxStackSize %d"), *ItemName, Item->MaxStackSize);
+            ++NumErrors;
+        }
+
+        if (Item->ItemType == EItemType::Weapon && Item->WeaponClass.IsNull())
+        {
+            UE_LOG(LogTemp, Error, TEXT("ItemCatalog: weapon '%s' has no WeaponClass"), *ItemName);
+            ++NumErrors;
+        }
+
+        if (Item->ItemType == EItemType::Placeable && Item->PlaceableClass.IsNull())
+        {
+            UE_LOG(LogTemp, Warning, TEXT("ItemCatalog: placeable '%s' has no PlaceableClass"), *ItemName);
+        }
+
+        if (Item->bIsCraftable && Item->CraftingRequirements.Num() == 0)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("ItemCatalog: '%s' is craftable from nothing"), *ItemName);
+        }
+
+        for (const FCraftingRequirement& Requirement : Item->CraftingRequirements)
+        {
+            if (!Names.Contains(Requirement.ItemName))
+            {
+                UE_LOG(LogTemp, Error, TEXT("ItemCatalog: '%s' requires unknown item '%s'"), *ItemName, *Requirement.ItemName.ToString());
+                ++NumErrors;
+            }
+            if (Requirement.Amount <= 0)
+            {
+                UE_LOG(LogTemp, Error, TEXT("ItemCatalog: '%s' requires %d of '%s'"), *ItemName, Requirement.Amount, *Requirement.ItemName.ToString());
+                ++NumErrors;
+            }
+        }
+    }
+
+    return NumErrors;
+}
@@ -0,0 +1,46 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "ItemCatalogCommandlet.generated.h"
+
+class UDataTable;
+class FObjectPreSaveContext;
+
+/**
+ * Validates DT_Items and bakes it into the binary catalog that packaged builds load
+ * (see UItemDatabase::LoadCatalog). Cooking the table does this automatically (see RegisterCookHook),
+ * so packaging always stages a catalog baked from the table it cooked. To bake by hand:
+ *
+ *   UnrealEditor-Cmd BridgeAndBlade.uproject -run=ItemCatalog [-Table=/Game/DT_Items.DT_Items] [-Output=<file>]
+ *
+ * Returns non-zero if the table has errors; the catalog is then deleted rather than left stale.
+ */
+UCLASS()
+class BRIDGEANDBLADE_API UItemCatalogCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UItemCatalogCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+
+    // Validate Table and write its catalog to OutputPath unless the file there already has the same source hash
+    static bool BakeCatalog(UDataTable& Table, const FString& OutputPath);
+
+#if WITH_EDITOR
+    // Rebake the catalog whenever an item table is saved for cooking; called once at module startup
+    static void RegisterCookHook();
+#endif
+
+private:
+    // Logs every problem; returns the number of errors (warnings don't count)
+    static int32 ValidateTable(const UDataTable& Table);
+
+#if WITH_EDITOR
+    static void HandleObjectPreSave(UObject* Object, FObjectPreSaveContext SaveContext);
+#endif
+};
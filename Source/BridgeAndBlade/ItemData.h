@@ -24,6 +24,48 @@ enum class EArmorSlot : uint8
     Boots UMETA(DisplayName = "Boots")
 };
 
+/**
+ * Dense runtime id of an item: its index in UItemDatabase, assigned when the database is initialized.
+ * Only valid for the lifetime of that database; persist items by FName.
+ */
+struct FItemId
+{
+    static constexpr uint16 InvalidValue = MAX_uint16;
+
+    uint16 Value = InvalidValue;
+
+    FItemId() = default;
+    explicit FItemId(uint16 InValue) : Value(InValue) {}
+
+    bool IsValid() const { return Value != InvalidValue; }
+    int32 ToIndex() const { return Value; }
+
+    bool operator==(const FItemId& Other) const { return Value == Other.Value; }
+    bool operator!=(const FItemId& Other) const { return Value != Other.Value; }
+
+    friend uint32 GetTypeHash(const FItemId& Id) { return Id.Value; }
+
+    friend FArchive& operator<<(FArchive& Ar, FItemId& Id) { return Ar << Id.Value; }
+};
+
+// Crafting requirement with the material resolved to its id
+struct FItemRequirement
+{
+    FItemId ItemId;
+    int32 Amount = 0;
+
+    friend FArchive& operator<<(FArchive& Ar, FItemRequirement& Requirement) { return Ar << Requirement.ItemId << Requirement.Amount; }
+};
+
+// One requirement line of a recipe, seen from the material's side (reverse index entry)
+struct FRecipeUse
+{
+    FItemId RecipeId;
+    int32 Amount = 0;
+
+    friend FArchive& operator<<(FArchive& Ar, FRecipeUse& Use) { return Ar << Use.RecipeId << Use.Amount; }
+};
+
 USTRUCT(BlueprintType)
 struct FCraftingRequirement
 {
@@ -61,8 +103,9 @@ struct FItemData : public FTableRowBase
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Basic Info")
     EItemType ItemType;
 
+    // Soft like WeaponClass, so loading the table doesn't load every icon; UItemDatabase::GetItemIcon resolves it
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Basic Info")
-    UTexture2D* Icon;
+    TSoftObjectPtr<class UTexture2D> Icon;
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Basic Info")
     int MaxStackSize;
@@ -73,9 +116,9 @@ struct FItemData : public FTableRowBase
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Crafting")
     bool bIsCraftable;
 
-    // For weapons
+    // For weapons (soft so the table doesn't pull every weapon blueprint in; see UIslandPreloadSubsystem)
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Weapon", meta = (EditCondition = "ItemType == EItemType::Weapon"))
-    TSubclassOf<class AWeaponBase> WeaponClass;
+    TSoftClassPtr<class AWeaponBase> WeaponClass;
 
     // For armor
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Armor", meta = (EditCondition = "ItemType == EItemType::Armor"))
@@ -84,22 +127,19 @@ struct FItemData : public FTableRowBase
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Armor", meta = (EditCondition = "ItemType == EItemType::Armor"))
     float DefenseValue;
 
-    // For placeables
+    // For placeables (soft like WeaponClass; loaded when the item is placed or a saved one is restored)
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Placeable", meta = (EditCondition = "ItemType == EItemType::Placeable"))
-    TSubclassOf<class AActor> PlaceableClass;
+    TSoftClassPtr<class AActor> PlaceableClass;
 
     FItemData()
         : ItemName(NAME_None)
         , DisplayName(FText::FromString("Unknown Item"))
         , Description(FText::FromString("No description"))
         , ItemType(EItemType::Material)
-        , Icon(nullptr)
         , MaxStackSize(99)
         , bIsCraftable(false)
-        , WeaponClass(nullptr)
         , ArmorSlot(EArmorSlot::Head)
         , DefenseValue(0.0f)
-        , PlaceableClass(nullptr)
     {
     }
 };
\ No newline at end of file
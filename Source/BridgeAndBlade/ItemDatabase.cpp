@@ -2,33 +2,91 @@
 
 #include "ItemDatabase.h"
 #include "Engine/DataTable.h"
+#include "Engine/Texture2D.h"
+#include "GameFramework/Actor.h"
+#include "WeaponBase.h"
+#include "Engine/GameInstance.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "Kismet/GameplayStatics.h"
+#include "Misc/Crc.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
 
-UItemDatabase* UItemDatabase::Instance = nullptr;
-
-UItemDatabase* UItemDatabase::Get(UObject* WorldContextObject)
+void UItemDatabase::Initialize(FSubsystemCollectionBase& Collection)
 {
-    if (!Instance)
+    Super::Initialize(Collection);
+
+#if !WITH_EDITOR
+    // Packaged builds have everything before the first level loads; InitializeFromTable is then a no-op
+    if (!LoadCatalog(GetDefaultCatalogPath()))
     {
-        Instance = NewObject<UItemDatabase>();
-        Instance->AddToRoot(); // Prevent garbage collection
+        UE_LOG(LogTemp, Warning, TEXT("ItemDatabase: no usable baked catalog, waiting for the DataTable"));
+    }
+#endif
+}
 
-        UE_LOG(LogTemp, Log, TEXT("ItemDatabase singleton created"));
+void UItemDatabase::Deinitialize()
+{
+    if (IconsHandle.IsValid())
+    {
+        IconsHandle->CancelHandle();
+        IconsHandle.Reset();
     }
-    return Instance;
+
+    // Every derived table too, so nothing outlives the game instance that built it
+    Items.Empty();
+    ItemIndices.Empty();
+    Requirements.Empty();
+    RequirementStarts.Empty();
+    RecipeUses.Empty();
+    RecipeUseStarts.Empty();
+    TypeBuckets.Empty();
+    TypeBucketStarts.Empty();
+    CraftableIds.Empty();
+    IdsByName.Empty();
+    IdsByDisplayName.Empty();
+    ItemNames.Empty();
+    Icons.Empty();
+    ItemTable = nullptr;
+    bLoadedFromCatalog = false;
+
+    Super::Deinitialize();
 }
 
-void UItemDatabase::Initialize(UDataTable* ItemDataTable)
+UItemDatabase* UItemDatabase::Get(const UObject* WorldContextObject)
+{
+    UGameInstance* GameInstance = UGameplayStatics::GetGameInstance(WorldContextObject);
+    return GameInstance ? GameInstance->GetSubsystem<UItemDatabase>() : nullptr;
+}
+
+void UItemDatabase::InitializeFromTable(UDataTable* ItemDataTable)
 {
     if (!ItemDataTable)
     {
-        UE_LOG(LogTemp, Error, TEXT("ItemDatabase::Initialize - DataTable is null!"));
+        UE_LOG(LogTemp, Error, TEXT("ItemDatabase::InitializeFromTable - DataTable is null!"));
         return;
     }
 
+    // Built once per game instance; level travel keeps the ids (and everything keyed by them) valid
+    if (bLoadedFromCatalog || (ItemTable == ItemDataTable && Items.Num() > 0))
+        return;
+
     ItemTable = ItemDataTable;
     CacheItemData();
 
-    UE_LOG(LogTemp, Log, TEXT("ItemDatabase initialized with %d items"), ItemCache.Num());
+    UE_LOG(LogTemp, Log, TEXT("ItemDatabase initialized with %d items"), Items.Num());
+
+#if WITH_EDITOR
+    // Cooking rebakes the catalog, but say so if the one on disk was baked from an older table
+    uint32 CatalogHash = 0;
+    if (ReadCatalogSourceHash(GetDefaultCatalogPath(), CatalogHash) && CatalogHash != ComputeSourceHash())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("ItemDatabase: %s is out of date with %s"), *GetDefaultCatalogPath(), *ItemDataTable->GetPathName());
+    }
+#endif
 }
 
 void UItemDatabase::CacheItemData()
@@ -36,52 +94,552 @@ void UItemDatabase::CacheItemData()
     if (!ItemTable)
         return;
 
-    ItemCache.Empty();
+    Items.Reset();
+    ItemIndices.Reset();
 
-    TArray<FName> RowNames = ItemTable->GetRowNames();
-    for (const FName& RowName : RowNames)
+    const TMap<FName, uint8*>& RowMap = ItemTable->GetRowMap();
+    Items.Reserve(RowMap.Num());
+    ItemIndices.Reserve(RowMap.Num());
+
+    for (const TPair<FName, uint8*>& Row : RowMap)
     {
-        FItemData* ItemData = ItemTable->FindRow<FItemData>(RowName, TEXT("ItemDatabase"));
-        if (ItemData)
+        const FItemData* ItemData = reinterpret_cast<const FItemData*>(Row.Value);
+        if (!ItemData)
+            continue;
+
+        // Use the row name as the item name if not specified
+        const FName ItemName = ItemData->ItemName.IsNone() ? Row.Key : ItemData->ItemName;
+
+        // Later rows with the same item name replace earlier ones
+        if (const int32* Existing = ItemIndices.Find(ItemName))
+        {
+            Items[*Existing] = *ItemData;
+            Items[*Existing].ItemName = ItemName;
+            continue;
+        }
+
+        // Ids are uint16; anything past that can't be addressed
+        if (Items.Num() >= FItemId::InvalidValue)
         {
-            // Use the row name as the item name if not specified
-            if (ItemData->ItemName.IsNone())
+            UE_LOG(LogTemp, Error, TEXT("ItemDatabase: too many items, '%s' ignored"), *ItemName.ToString());
+            continue;
+        }
+
+        const int32 Index = Items.Add(*ItemData);
+        Items[Index].ItemName = ItemName;
+        ItemIndices.Add(ItemName, Index);
+    }
+
+    ResolveRequirements();
+    BuildRecipeIndex();
+    BuildBuckets();
+    BuildNameIndices();
+    StreamIcons();
+}
+
+void UItemDatabase::ResolveRequirements()
+{
+    Requirements.Reset();
+    RequirementStarts.Reset(Items.Num() + 1);
+
+    for (FItemData& Item : Items)
+    {
+        RequirementStarts.Add(Requirements.Num());
+        for (const FCraftingRequirement& Requirement : Item.CraftingRequirements)
+        {
+            const FItemId MaterialId = FindItemId(Requirement.ItemName);
+            if (!MaterialId.IsValid())
             {
-                ItemData->ItemName = RowName;
+                // A missing material can never be owned, so the recipe can never be crafted
+                UE_LOG(LogTemp, Warning, TEXT("ItemDatabase: '%s' requires unknown item '%s'"), *Item.ItemName.ToString(), *Requirement.ItemName.ToString());
+                Item.bIsCraftable = false;
+                continue;
             }
+            Requirements.Add({ MaterialId, Requirement.Amount });
+        }
+    }
+    RequirementStarts.Add(Requirements.Num());
+}
+
+void UItemDatabase::BuildRecipeIndex()
+{
+    // Counting pass, then fill: one contiguous block of uses per material
+    TArray<int32> UseCounts;
+    UseCounts.SetNumZeroed(Items.Num());
+
+    for (int32 Recipe = 0; Recipe < Items.Num(); ++Recipe)
+    {
+        if (!Items[Recipe].bIsCraftable)
+            continue;
+
+        for (int32 i = RequirementStarts[Recipe]; i < RequirementStarts[Recipe + 1]; ++i)
+        {
+            ++UseCounts[Requirements[i].ItemId.ToIndex()];
+        }
+    }
+
+    RecipeUseStarts.SetNumUninitialized(Items.Num() + 1);
+    int32 Running = 0;
+    for (int32 Material = 0; Material < Items.Num(); ++Material)
+    {
+        RecipeUseStarts[Material] = Running;
+        Running += UseCounts[Material];
+    }
+    RecipeUseStarts[Items.Num()] = Running;
+
+    RecipeUses.SetNum(Running);
+    TArray<int32> Cursor(RecipeUseStarts.GetData(), Items.Num());
+
+    for (int32 Recipe = 0; Recipe < Items.Num(); ++Recipe)
+    {
+        if (!Items[Recipe].bIsCraftable)
+            continue;
+
+        for (int32 i = RequirementStarts[Recipe]; i < RequirementStarts[Recipe + 1]; ++i)
+        {
+            const FItemRequirement& Requirement = Requirements[i];
+            RecipeUses[Cursor[Requirement.ItemId.ToIndex()]++] = { FItemId((uint16)Recipe), Requirement.Amount };
+        }
+    }
+}
+
+void UItemDatabase::BuildBuckets()
+{
+    TypeBucketStarts.SetNumZeroed(NumItemTypes + 1);
+    for (const FItemData& Item : Items)
+    {
+        ++TypeBucketStarts[(int32)Item.ItemType + 1];
+    }
+    for (int32 Type = 0; Type < NumItemTypes; ++Type)
+    {
+        TypeBucketStarts[Type + 1] += TypeBucketStarts[Type];
+    }
+
+    TypeBuckets.SetNum(Items.Num());
+    TArray<int32> Cursor(TypeBucketStarts.GetData(), NumItemTypes);
+    CraftableIds.Reset();
+
+    for (int32 Index = 0; Index < Items.Num(); ++Index)
+    {
+        TypeBuckets[Cursor[(int32)Items[Index].ItemType]++] = FItemId((uint16)Index);
+        if (Items[Index].bIsCraftable)
+        {
+            CraftableIds.Add(FItemId((uint16)Index));
+        }
+    }
+}
+
+void UItemDatabase::BuildNameIndices()
+{
+    ItemIndices.Reset();
+    ItemIndices.Reserve(Items.Num());
+    ItemNames.Reset(Items.Num());
+    IdsByName.Reset(Items.Num());
+
+    for (int32 Index = 0; Index < Items.Num(); ++Index)
+    {
+        ItemIndices.Add(Items[Index].ItemName, Index);
+        ItemNames.Add(Items[Index].ItemName);
+        IdsByName.Add(FItemId((uint16)Index));
+    }
+
+    // Ties fall back to id order so the result doesn't depend on the sort
+    IdsByDisplayName = IdsByName;
+
+    IdsByName.Sort([this](FItemId A, FItemId B)
+    {
+        const int32 Order = ItemNames[A.ToIndex()].Compare(ItemNames[B.ToIndex()]);
+        return Order != 0 ? Order < 0 : A.Value < B.Value;
+    });
+
+    // Display names are localized, so this order is never baked into the catalog
+    IdsByDisplayName.Sort([this](FItemId A, FItemId B)
+    {
+        const int32 Order = Items[A.ToIndex()].DisplayName.CompareTo(Items[B.ToIndex()].DisplayName);
+        return Order != 0 ? Order < 0 : A.Value < B.Value;
+    });
+}
+
+FString UItemDatabase::GetDefaultCatalogPath()
+{
+    return FPaths::ProjectContentDir() / TEXT("Data/ItemCatalog.bin");
+}
+
+bool UItemDatabase::SaveCatalog(const FString& FilePath) const
+{
+    TArray<uint8> Body;
+    WriteCatalogBody(Body);
+
+    TArray<uint8> Bytes;
+    FMemoryWriter Ar(Bytes, /*bIsPersistent*/ true);
+
+    uint32 Magic = CatalogMagic;
+    int32 Version = CatalogVersion;
+    uint32 SourceHash = FCrc::MemCrc32(Body.GetData(), Body.Num());
+    Ar << Magic << Version << SourceHash;
+    Ar.Serialize(Body.GetData(), Body.Num());
+
+    if (!FFileHelper::SaveArrayToFile(Bytes, *FilePath))
+    {
+        UE_LOG(LogTemp, Error, TEXT("ItemDatabase: failed to write catalog %s"), *FilePath);
+        return false;
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("ItemDatabase: wrote catalog %s (%d items, %d bytes)"), *FilePath, Items.Num(), Bytes.Num());
+    return true;
+}
+
+uint32 UItemDatabase::ComputeSourceHash() const
+{
+    TArray<uint8> Body;
+    WriteCatalogBody(Body);
+    return FCrc::MemCrc32(Body.GetData(), Body.Num());
+}
+
+bool UItemDatabase::ReadCatalogSourceHash(const FString& FilePath, uint32& OutHash)
+{
+    TArray<uint8> Bytes;
+    if (!FFileHelper::LoadFileToArray(Bytes, *FilePath, FILEREAD_Silent))
+        return false;
+
+    FMemoryReader Ar(Bytes, /*bIsPersistent*/ true);
+
+    uint32 Magic = 0;
+    int32 Version = 0;
+    Ar << Magic << Version << OutHash;
+    return !Ar.IsError() && Magic == CatalogMagic && Version == CatalogVersion;
+}
+
+void UItemDatabase::WriteCatalogBody(TArray<uint8>& OutBytes) const
+{
+    FMemoryWriter Ar(OutBytes, /*bIsPersistent*/ true);
+
+    int32 NumItems = Items.Num();
+    Ar << NumItems;
+
+    // Name table: everything after this refers to items by id, so each name is stored once
+    for (const FItemData& Item : Items)
+    {
+        FString Name = Item.ItemName.ToString();
+        Ar << Name;
+    }
+
+    // Dense records; assets are stored as paths and resolved on load
+    for (const FItemData& Item : Items)
+    {
+        uint8 Type = (uint8)Item.ItemType;
+        uint8 Slot = (uint8)Item.ArmorSlot;
+        bool bCraftable = Item.bIsCraftable;
+        int32 MaxStack = Item.MaxStackSize;
+        float Defense = Item.DefenseValue;
+        FText DisplayName = Item.DisplayName;
+        FText Description = Item.Description;
+        FString IconPath = Item.Icon.ToSoftObjectPath().ToString();
+        FString WeaponPath = Item.WeaponClass.ToSoftObjectPath().ToString();
+        FString PlaceablePath = Item.PlaceableClass.ToSoftObjectPath().ToString();
+
+        Ar << Type << Slot << bCraftable << MaxStack << Defense;
+        Ar << DisplayName << Description << IconPath << WeaponPath << PlaceablePath;
+    }
+
+    // Packed tables exactly as the runtime uses them
+    TArray<int32> OutRequirementStarts = RequirementStarts;
+    TArray<FItemRequirement> OutRequirements = Requirements;
+    TArray<int32> OutRecipeUseStarts = RecipeUseStarts;
+    TArray<FRecipeUse> OutRecipeUses = RecipeUses;
+    TArray<int32> OutTypeBucketStarts = TypeBucketStarts;
+    TArray<FItemId> OutTypeBuckets = TypeBuckets;
+    TArray<FItemId> OutCraftableIds = CraftableIds;
+
+    Ar << OutRequirementStarts << OutRequirements;
+    Ar << OutRecipeUseStarts << OutRecipeUses;
+    Ar << OutTypeBucketStarts << OutTypeBuckets << OutCraftableIds;
+}
+
+bool UItemDatabase::LoadCatalog(const FString& FilePath)
+{
+    // One read for the whole catalog, then parse from memory
+    TArray<uint8> Bytes;
+    if (!FFileHelper::LoadFileToArray(Bytes, *FilePath, FILEREAD_Silent))
+        return false;
+
+    FMemoryReader Ar(Bytes, /*bIsPersistent*/ true);
+
+    uint32 Magic = 0;
+    int32 Version = 0;
+    uint32 SourceHash = 0;
+    Ar << Magic << Version << SourceHash;
+
+    if (Ar.IsError() || Magic != CatalogMagic || Version != CatalogVersion)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("ItemDatabase: %s is not a version %d catalog"), *FilePath, CatalogVersion);
+        return false;
+    }
+
+    // The hash covers the whole body, so it also catches a damaged file
+    const int64 BodyStart = Ar.Tell();
+    if (FCrc::MemCrc32(Bytes.GetData() + BodyStart, Bytes.Num() - BodyStart) != SourceHash)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("ItemDatabase: catalog %s does not match its source hash"), *FilePath);
+        return false;
+    }
+
+    int32 NumItems = 0;
+    Ar << NumItems;
+    if (NumItems < 0 || NumItems >= FItemId::InvalidValue)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("ItemDatabase: catalog %s has %d items"), *FilePath, NumItems);
+        return false;
+    }
+
+    // Parse into locals so a truncated file leaves the current contents alone
+    TArray<FItemData> NewItems;
+    NewItems.SetNum(NumItems);
+
+    for (FItemData& Item : NewItems)
+    {
+        FString Name;
+        Ar << Name;
+        Item.ItemName = FName(*Name);
+    }
+
+    for (FItemData& Item : NewItems)
+    {
+        uint8 Type = 0;
+        uint8 Slot = 0;
+        FString IconPath;
+        FString WeaponPath;
+        FString PlaceablePath;
+
+        Ar << Type << Slot << Item.bIsCraftable << Item.MaxStackSize << Item.DefenseValue;
+        Ar << Item.DisplayName << Item.Description << IconPath << WeaponPath << PlaceablePath;
+
+        Item.ItemType = (EItemType)FMath::Min<int32>(Type, NumItemTypes - 1);
+        Item.ArmorSlot = (EArmorSlot)Slot;
+        Item.WeaponClass = TSoftClassPtr<AWeaponBase>(FSoftObjectPath(WeaponPath));
+        Item.PlaceableClass = TSoftClassPtr<AActor>(FSoftObjectPath(PlaceablePath));
+        Item.Icon = TSoftObjectPtr<UTexture2D>(FSoftObjectPath(IconPath));
+    }
+
+    TArray<int32> NewRequirementStarts;
+    TArray<FItemRequirement> NewRequirements;
+    TArray<int32> NewRecipeUseStarts;
+    TArray<FRecipeUse> NewRecipeUses;
+    TArray<int32> NewTypeBucketStarts;
+    TArray<FItemId> NewTypeBuckets;
+    TArray<FItemId> NewCraftableIds;
+
+    Ar << NewRequirementStarts << NewRequirements;
+    Ar << NewRecipeUseStarts << NewRecipeUses;
+    Ar << NewTypeBucketStarts << NewTypeBuckets << NewCraftableIds;
+
+    if (Ar.IsError() || NewRequirementStarts.Num() != NumItems + 1 || NewRecipeUseStarts.Num() != NumItems + 1
+        || NewTypeBucketStarts.Num() != NumItemTypes + 1 || NewTypeBuckets.Num() != NumItems
+        || !ValidatePacked(NewRequirementStarts, NewRequirements.Num()) || !ValidatePacked(NewRecipeUseStarts, NewRecipeUses.Num())
+        || !ValidatePacked(NewTypeBucketStarts, NewTypeBuckets.Num())
+        || !ValidateIds(NewTypeBuckets, NumItems) || !ValidateIds(NewCraftableIds, NumItems)
+        || NewRequirements.ContainsByPredicate([NumItems](const FItemRequirement& Requirement) { return !ValidateIds(MakeArrayView(&Requirement.ItemId, 1), NumItems); })
+        || NewRecipeUses.ContainsByPredicate([NumItems](const FRecipeUse& Use) { return !ValidateIds(MakeArrayView(&Use.RecipeId, 1), NumItems); }))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("ItemDatabase: catalog %s is truncated or corrupt"), *FilePath);
+        return false;
+    }
+
+    // FItemData keeps the by-name requirements for Blueprint callers; rebuild them from the ids
+    for (int32 Index = 0; Index < NumItems; ++Index)
+    {
+        FItemData& Item = NewItems[Index];
+        for (int32 i = NewRequirementStarts[Index]; i < NewRequirementStarts[Index + 1]; ++i)
+        {
+            const FItemRequirement& Requirement = NewRequirements[i];
+            Item.CraftingRequirements.Emplace(NewItems[Requirement.ItemId.ToIndex()].ItemName, Requirement.Amount);
+        }
+    }
+
+    Items = MoveTemp(NewItems);
+    Requirements = MoveTemp(NewRequirements);
+    RequirementStarts = MoveTemp(NewRequirementStarts);
+    RecipeUses = MoveTemp(NewRecipeUses);
+    RecipeUseStarts = MoveTemp(NewRecipeUseStarts);
+    TypeBuckets = MoveTemp(NewTypeBuckets);
+    TypeBucketStarts = MoveTemp(NewTypeBucketStarts);
+    CraftableIds = MoveTemp(NewCraftableIds);
+
+    BuildNameIndices();
+    StreamIcons();
+
+    bLoadedFromCatalog = true;
+    UE_LOG(LogTemp, Log, TEXT("ItemDatabase loaded %d items from catalog %s"), Items.Num(), *FilePath);
+    return true;
+}
+
+bool UItemDatabase::ValidatePacked(const TArray<int32>& Starts, int32 NumEntries)
+{
+    if (Starts.Num() == 0 || Starts[0] != 0 || Starts.Last() != NumEntries)
+        return false;
+
+    for (int32 Index = 1; Index < Starts.Num(); ++Index)
+    {
+        if (Starts[Index] < Starts[Index - 1])
+            return false;
+    }
+    return true;
+}
+
+bool UItemDatabase::ValidateIds(TArrayView<const FItemId> Ids, int32 NumItems)
+{
+    for (FItemId Id : Ids)
+    {
+        if (!Id.IsValid() || Id.ToIndex() >= NumItems)
+            return false;
+    }
+    return true;
+}
+
+void UItemDatabase::StreamIcons()
+{
+    if (IconsHandle.IsValid())
+    {
+        IconsHandle->CancelHandle();
+        IconsHandle.Reset();
+    }
+
+    Icons.Reset();
+    Icons.SetNum(Items.Num());
+
+    TArray<FSoftObjectPath> Paths;
+    for (const FItemData& Item : Items)
+    {
+        if (!Item.Icon.IsNull())
+        {
+            Paths.AddUnique(Item.Icon.ToSoftObjectPath());
+        }
+    }
+
+    // Low priority: the first level matters more, and anything shown before this lands loads on demand
+    if (Paths.Num() > 0 && UAssetManager::IsInitialized())
+    {
+        IconsHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(Paths,
+            FStreamableDelegate::CreateUObject(this, &UItemDatabase::ResolveLoadedIcons), FStreamableManager::DefaultAsyncLoadPriority - 1);
+    }
+}
 
-            ItemCache.Add(ItemData->ItemName, *ItemData);
+void UItemDatabase::ResolveLoadedIcons()
+{
+    for (int32 Index = 0; Index < Icons.Num() && Index < Items.Num(); ++Index)
+    {
+        if (!Icons[Index])
+        {
+            Icons[Index] = Items[Index].Icon.Get();
         }
     }
 }
 
+UTexture2D* UItemDatabase::GetItemIcon(const FItemData& Item)
+{
+    if (Item.Icon.IsNull())
+        return nullptr;
+
+    const int32 Index = FindItemIndex(Item.ItemName);
+    if (!Icons.IsValidIndex(Index))
+        return Item.Icon.LoadSynchronous();
+
+    // Shown before the background stream got to it; this one icon is worth a sync load
+    if (!Icons[Index])
+    {
+        Icons[Index] = Item.Icon.LoadSynchronous();
+    }
+    return Icons[Index];
+}
+
+FItemId UItemDatabase::FindItemId(FName ItemName) const
+{
+    const int32* Index = ItemIndices.Find(ItemName);
+    return Index ? FItemId((uint16)*Index) : FItemId();
+}
+
+FName UItemDatabase::GetItemName(FItemId Id) const
+{
+    const FItemData* Item = GetItem(Id);
+    return Item ? Item->ItemName : NAME_None;
+}
+
+TArrayView<const FRecipeUse> UItemDatabase::GetRecipesUsing(FItemId Material) const
+{
+    if (!Material.IsValid() || !RecipeUseStarts.IsValidIndex(Material.ToIndex() + 1))
+    {
+        return TArrayView<const FRecipeUse>();
+    }
+
+    const int32 Start = RecipeUseStarts[Material.ToIndex()];
+    return TArrayView<const FRecipeUse>(RecipeUses.GetData() + Start, RecipeUseStarts[Material.ToIndex() + 1] - Start);
+}
+
+TArrayView<const FItemId> UItemDatabase::GetItemIdsOfType(EItemType ItemType) const
+{
+    const int32 Type = (int32)ItemType;
+    if (!TypeBucketStarts.IsValidIndex(Type + 1))
+    {
+        return TArrayView<const FItemId>();
+    }
+
+    const int32 Start = TypeBucketStarts[Type];
+    return TArrayView<const FItemId>(TypeBuckets.GetData() + Start, TypeBucketStarts[Type + 1] - Start);
+}
+
+TArrayView<const FItemRequirement> UItemDatabase::GetRequirements(FItemId Id) const
+{
+    if (!Id.IsValid() || !RequirementStarts.IsValidIndex(Id.ToIndex() + 1))
+    {
+        return TArrayView<const FItemRequirement>();
+    }
+
+    const int32 Start = RequirementStarts[Id.ToIndex()];
+    return TArrayView<const FItemRequirement>(Requirements.GetData() + Start, RequirementStarts[Id.ToIndex() + 1] - Start);
+}
+
+const FItemData* UItemDatabase::FindItem(FName ItemName) const
+{
+    const int32* Index = ItemIndices.Find(ItemName);
+    return Index ? &Items[*Index] : nullptr;
+}
+
+int32 UItemDatabase::FindItemIndex(FName ItemName) const
+{
+    const int32* Index = ItemIndices.Find(ItemName);
+    return Index ? *Index : INDEX_NONE;
+}
+
 bool UItemDatabase::GetItemData(FName ItemName, FItemData& OutItemData) const
 {
-    if (ItemCache.Contains(ItemName))
+    if (const FItemData* ItemData = FindItem(ItemName))
     {
-        OutItemData = ItemCache[ItemName];
+        OutItemData = *ItemData;
         return true;
     }
 
-    UE_LOG(LogTemp, Warning, TEXT("Item '%s' not found in database"), *ItemName.ToString());
+    // Empty quick slots etc. look up NAME_None; that's not worth a warning
+    if (!ItemName.IsNone())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Item '%s' not found in database"), *ItemName.ToString());
+    }
     return false;
 }
 
 bool UItemDatabase::HasItem(FName ItemName) const
 {
-    return ItemCache.Contains(ItemName);
+    return ItemIndices.Contains(ItemName);
 }
 
 TArray<FItemData> UItemDatabase::GetItemsByType(EItemType ItemType) const
 {
-    TArray<FItemData> Result;
+    const TArrayView<const FItemId> Bucket = GetItemIdsOfType(ItemType);
 
-    for (const auto& Pair : ItemCache)
+    TArray<FItemData> Result;
+    Result.Reserve(Bucket.Num());
+    for (FItemId Id : Bucket)
     {
-        if (Pair.Value.ItemType == ItemType)
-        {
-            Result.Add(Pair.Value);
-        }
+        Result.Add(Items[Id.ToIndex()]);
     }
 
     return Result;
@@ -90,13 +648,10 @@ TArray<FItemData> UItemDatabase::GetItemsByType(EItemType ItemType) const
 TArray<FItemData> UItemDatabase::GetCraftableItems() const
 {
     TArray<FItemData> Result;
-
-    for (const auto& Pair : ItemCache)
+    Result.Reserve(CraftableIds.Num());
+    for (FItemId Id : CraftableIds)
     {
-        if (Pair.Value.bIsCraftable)
-        {
-            Result.Add(Pair.Value);
-        }
+        Result.Add(Items[Id.ToIndex()]);
     }
 
     return Result;
@@ -104,26 +659,17 @@ TArray<FItemData> UItemDatabase::GetCraftableItems() const
 
 bool UItemDatabase::CanCraftItem(FName ItemName, const TMap<FName, int>& AvailableMaterials) const
 {
-    FItemData ItemData;
-    if (!GetItemData(ItemName, ItemData))
-    {
-        return false;
-    }
-
-    if (!ItemData.bIsCraftable)
+    const FItemData* ItemData = FindItem(ItemName);
+    if (!ItemData || !ItemData->bIsCraftable)
     {
         return false;
     }
 
     // Check if we have all required materials
-    for (const FCraftingRequirement& Requirement : ItemData.CraftingRequirements)
+    for (const FCraftingRequirement& Requirement : ItemData->CraftingRequirements)
     {
-        if (!AvailableMaterials.Contains(Requirement.ItemName))
-        {
-            return false;
-        }
-
-        if (AvailableMaterials[Requirement.ItemName] < Requirement.Amount)
+        const int* Available = AvailableMaterials.Find(Requirement.ItemName);
+        if (!Available || *Available < Requirement.Amount)
         {
             return false;
         }
@@ -134,7 +680,5 @@ bool UItemDatabase::CanCraftItem(FName ItemName, const TMap<FName, int>& Availab
 
 TArray<FName> UItemDatabase::GetAllItemNames() const
 {
-    TArray<FName> Names;
-    ItemCache.GetKeys(Names);
-    return Names;
-}
\ No newline at end of file
+    return ItemNames;
+}
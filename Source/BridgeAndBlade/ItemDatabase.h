@@ -3,42 +3,102 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "UObject/NoExportTypes.h"
+#include "Subsystems/GameInstanceSubsystem.h"
 #include "Engine/DataTable.h"
 #include "ItemData.h"
 #include "ItemDatabase.generated.h"
 
+struct FStreamableHandle;
+
 
 /**
- * 
+ * Item definitions, one database per game instance. It is built once (from the baked catalog in
+ * packaged builds, from DT_Items otherwise) and then kept across level travel; every PIE client
+ * and every game instance in the process has its own copy, so nothing mutable is shared.
  */
-UCLASS(Blueprintable, BlueprintType)
-class BRIDGEANDBLADE_API UItemDatabase : public UObject
+UCLASS(BlueprintType)
+class BRIDGEANDBLADE_API UItemDatabase : public UGameInstanceSubsystem
 {
     GENERATED_BODY()
 
 public:
-    // Get the singleton instance
-    UFUNCTION(BlueprintCallable, Category = "Item Database")
-    static UItemDatabase* Get(UObject* WorldContextObject);
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    // Database of the game instance WorldContextObject belongs to (nullptr outside a game instance)
+    UFUNCTION(BlueprintCallable, Category = "Item Database", meta = (WorldContext = "WorldContextObject"))
+    static UItemDatabase* Get(const UObject* WorldContextObject);
 
-    // Initialize the database with a data table
+    // Build the database from a data table. A no-op once built from this table or from the catalog,
+    // so every level's player can call it without re-caching.
     UFUNCTION(BlueprintCallable, Category = "Item Database")
-    void Initialize(UDataTable* ItemDataTable);
+    void InitializeFromTable(UDataTable* ItemDataTable);
+
+    // Baked catalog (Content/Data/ItemCatalog.bin), rebaked from DT_Items whenever the table is cooked
+    static FString GetDefaultCatalogPath();
+
+    // Replace the contents with a baked catalog, read in one go. Leaves the database untouched on failure.
+    bool LoadCatalog(const FString& FilePath);
+
+    // Write the current contents as a catalog, headed by their source hash
+    bool SaveCatalog(const FString& FilePath) const;
+
+    // CRC of the current contents as a catalog stores them; a table and a catalog baked from it hash the same
+    uint32 ComputeSourceHash() const;
+
+    // Source hash from a catalog's header; false if there is no readable catalog of this version
+    static bool ReadCatalogSourceHash(const FString& FilePath, uint32& OutHash);
+
+    bool IsLoadedFromCatalog() const { return bLoadedFromCatalog; }
 
-    // Get item data by name
+    // Get item data by name (copies the row; C++ callers should prefer FindItem)
     UFUNCTION(BlueprintCallable, Category = "Item Database")
     bool GetItemData(FName ItemName, FItemData& OutItemData) const;
 
+    // Pointer into the database's own storage, nullptr if unknown. No copy and no logging on a miss.
+    // Valid until the database is re-initialized.
+    const FItemData* FindItem(FName ItemName) const;
+
+    // Dense index of an item (0..GetNumItems()-1), INDEX_NONE if unknown
+    int32 FindItemIndex(FName ItemName) const;
+
+    const FItemData* GetItemAt(int32 Index) const { return Items.IsValidIndex(Index) ? &Items[Index] : nullptr; }
+    int32 GetNumItems() const { return Items.Num(); }
+
+    // Dense id lookups; ids index straight into the item array
+    FItemId FindItemId(FName ItemName) const;
+    const FItemData* GetItem(FItemId Id) const { return GetItemAt(Id.IsValid() ? Id.ToIndex() : INDEX_NONE); }
+    FName GetItemName(FItemId Id) const;
+
+    // Requirements of a recipe with materials already resolved to ids (recipes with unknown materials are marked not craftable)
+    TArrayView<const FItemRequirement> GetRequirements(FItemId Id) const;
+
+    // Every requirement line of a craftable recipe that consumes Material (reverse of GetRequirements)
+    TArrayView<const FRecipeUse> GetRecipesUsing(FItemId Material) const;
+
+    // Precomputed buckets, in table order. Views into the database: no copies, valid until it is rebuilt.
+    TArrayView<const FItemId> GetItemIdsOfType(EItemType ItemType) const;
+    TArrayView<const FItemId> GetCraftableItemIds() const { return CraftableIds; }
+
+    // Every item id, sorted by ItemName (lexical) / by DisplayName (current culture)
+    TArrayView<const FItemId> GetItemIdsByName() const { return IdsByName; }
+    TArrayView<const FItemId> GetItemIdsByDisplayName() const { return IdsByDisplayName; }
+
+    // Item names in id order
+    TArrayView<const FName> GetItemNames() const { return ItemNames; }
+
+    // Item.Icon, loading it first if the background stream hasn't got to it yet (nullptr if the item has none)
+    UTexture2D* GetItemIcon(const FItemData& Item);
+
     // Check if an item exists
     UFUNCTION(BlueprintCallable, Category = "Item Database")
     bool HasItem(FName ItemName) const;
 
-    // Get all items of a specific type
+    // Get all items of a specific type (copies; C++ callers should use GetItemIdsOfType)
     UFUNCTION(BlueprintCallable, Category = "Item Database")
     TArray<FItemData> GetItemsByType(EItemType ItemType) const;
 
-    // Get all craftable items
+    // Get all craftable items (copies; C++ callers should use GetCraftableItemIds)
     UFUNCTION(BlueprintCallable, Category = "Item Database")
     TArray<FItemData> GetCraftableItems() const;
 
@@ -46,7 +106,7 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Item Database")
     bool CanCraftItem(FName ItemName, const TMap<FName, int>& AvailableMaterials) const;
 
-    // Get all item names
+    // Get all item names (copies; C++ callers should use GetItemNames)
     UFUNCTION(BlueprintCallable, Category = "Item Database")
     TArray<FName> GetAllItemNames() const;
 
@@ -54,10 +114,62 @@ protected:
     UPROPERTY()
     UDataTable* ItemTable;
 
+    // Item rows stored densely in table order
     UPROPERTY()
-    TMap<FName, FItemData> ItemCache;
+    TArray<FItemData> Items;
+
+    // ItemName -> index into Items
+    TMap<FName, int32> ItemIndices;
+
+    // Resolved requirements of every item, packed; item i owns [RequirementStarts[i], RequirementStarts[i + 1])
+    TArray<FItemRequirement> Requirements;
+    TArray<int32> RequirementStarts;
+
+    // Reverse index, packed the same way: material i is used by [RecipeUseStarts[i], RecipeUseStarts[i + 1])
+    TArray<FRecipeUse> RecipeUses;
+    TArray<int32> RecipeUseStarts;
+
+    // Item ids grouped by type, packed; type t owns [TypeBucketStarts[t], TypeBucketStarts[t + 1])
+    TArray<FItemId> TypeBuckets;
+    TArray<int32> TypeBucketStarts;
+
+    TArray<FItemId> CraftableIds;
+
+    TArray<FItemId> IdsByName;
+    TArray<FItemId> IdsByDisplayName;
+    TArray<FName> ItemNames;
+
+    bool bLoadedFromCatalog = false;
+
+    // Resolved icons by item index, held so they stay loaded; they stream in behind IconsHandle or load on first use
+    UPROPERTY(Transient)
+    TArray<TObjectPtr<UTexture2D>> Icons;
+    TSharedPtr<FStreamableHandle> IconsHandle;
 
 private:
-    static UItemDatabase* Instance;
+    static constexpr uint32 CatalogMagic = 0x43494242; // "BBIC"
+
+    // Bump whenever the record layout changes; older files are rejected and the table is used instead
+    static constexpr int32 CatalogVersion = 1;
+
+    // Everything after the header: names, records and the packed tables
+    void WriteCatalogBody(TArray<uint8>& OutBytes) const;
+
+    static constexpr int32 NumItemTypes = (int32)EItemType::Armor + 1;
+
     void CacheItemData();
+    void ResolveRequirements();
+    void BuildRecipeIndex();
+    void BuildBuckets();
+
+    // Name lookups and sorted orders; runs after both the table and the catalog path
+    void BuildNameIndices();
+
+    // Offsets monotonic and in range, every id below NumItems
+    static bool ValidatePacked(const TArray<int32>& Starts, int32 NumEntries);
+    static bool ValidateIds(TArrayView<const FItemId> Ids, int32 NumItems);
+
+    // Start loading every item's icon at low priority; runs after both the table and the catalog path
+    void StreamIcons();
+    void ResolveLoadedIcons();
 };
@@ -1,100 +1,128 @@
 // PaperBase.cpp
 #include "PaperBase.h"
 #include "PaperChar.h"
+#include "CombatTextSubsystem.h"
+#include "SignificanceSubsystem.h"
+#include "GameFramework/CharacterMovementComponent.h"
 #include "Kismet/GameplayStatics.h"
 
 APaperBase::APaperBase()
 {
+    // Walk animation is driven by USpriteAnimationSubsystem, not per-actor Tick. Ticking stays
+    // possible: BeginPlay turns it on for Blueprints with Event Tick, subclasses can opt back in.
     PrimaryActorTick.bCanEverTick = true;
+    PrimaryActorTick.bStartWithTickEnabled = false;
     bHasMoved = false;
     health = 100; // Default health
+
+    Attributes = CreateDefaultSubobject<UAttributeComponent>(TEXT("Attributes"));
 }
 
 void APaperBase::BeginPlay()
 {
     Super::BeginPlay();
 
-	lastHP = health; // Initialize lastHP to current health at start
+    Attributes->OnAttributeChanged.AddUObject(this, &APaperBase::HandleAttributeChanged);
+    Attributes->ResetValue(EAttribute::Health, health);
+    Attributes->ResetValue(EAttribute::MoveSpeed, GetCharacterMovement()->MaxWalkSpeed);
+
+    if (GetClass()->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(APaperBase, ReceiveTick)))
+    {
+        SetActorTickEnabled(true);
+    }
+
+    if (USpriteAnimationSubsystem* Animation = USpriteAnimationSubsystem::Get(this))
+    {
+        Animation->Register(this);
+    }
+
+    if (USignificanceSubsystem* Significance = USignificanceSubsystem::Get(this))
+    {
+        Significance->Register(this);
+    }
 }
 
-void APaperBase::Tick(float DeltaTime)
+void APaperBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-    Super::Tick(DeltaTime);
-    UpdateAnimation();
+    if (USpriteAnimationSubsystem* Animation = USpriteAnimationSubsystem::Get(this))
+    {
+        Animation->Unregister(this);
+    }
 
-    if (health != lastHP)
+    if (USignificanceSubsystem* Significance = USignificanceSubsystem::Get(this))
     {
-        // Health has changed since last tick, so we know we took damage (or were healed)
-        int DamageTaken = lastHP - health;
-        FString DamageText = FString::Printf(TEXT("%d"), FMath::Abs(DamageTaken));
-
-        // Choose color based on damage or healing
-        const FColor TextColor = (DamageTaken > 0) ? FColor::Red : FColor::Green;
-
-        // Spawn the floating text at the enemy's location, slightly above it
-        FVector TextLocation = GetActorLocation() + FVector(0.f, 0.f, 100.f);
-
-        // Draw debug string in world
-        DrawDebugString(
-            GetWorld(),
-            TextLocation,
-            DamageText,
-            nullptr,
-            TextColor,
-            2.0f, // Duration in seconds
-            true,  // Draw shadow
-            2.0f   // Text scale
-        );
-
-        // Update lastHP for next comparison
-        lastHP = health;
-
-        UE_LOG(LogTemp, Log, TEXT("%s took %d damage"), *GetName(), DamageTaken);
+        Significance->Unregister(this);
     }
+
+    Super::EndPlay(EndPlayReason);
 }
 
-void APaperBase::UpdateAnimation()
+void APaperBase::Tick(float DeltaTime)
 {
-    const float Speed = GetVelocity().Size();
-    const float MoveY = GetVelocity().Y;
-    const float MoveX = GetVelocity().X;
+    Super::Tick(DeltaTime);
+}
 
-    // Check if moving
-    if (Speed > 5.f)
+void APaperBase::ReportHealthChange(int32 Delta)
+{
+    // Floating damage / heal numbers are event driven; nothing polls health per frame
+    if (UWorld* World = GetWorld())
     {
-        bHasMoved = true;
-        
-        // Determine which direction is dominant
-        if (FMath::Abs(MoveY) > FMath::Abs(MoveX))
+        if (UCombatTextSubsystem* CombatText = World->GetSubsystem<UCombatTextSubsystem>())
         {
-            // Moving more horizontally (Y axis: side to side)
-            if (MoveY > 0)
-            {
-                // Moving right
-                GetSprite()->SetRelativeScale3D(FVector(1.f, 1.f, 1.f));
-                GetSprite()->SetFlipbook(WalkSideFlipbook);
-            }
-            else
-            {
-                // Moving left
-                GetSprite()->SetRelativeScale3D(FVector(-1.f, 1.f, 1.f));
-                GetSprite()->SetFlipbook(WalkSideFlipbook);
-            }
+            CombatText->ReportHealthChange(this, Delta);
         }
-        else
+    }
+}
+
+void APaperBase::HandleAttributeChanged(const FAttributeChange& Change)
+{
+    switch (Change.Attribute)
+    {
+    case EAttribute::Health:
         {
-            // Moving more vertically (X axis: up and down)
-            if (MoveX > 0)
-            {
-                // Moving up
-                GetSprite()->SetFlipbook(WalkUpFlipbook);
-            }
-            else
+            // Keep the Blueprint-visible value in step
+            health = FMath::RoundToInt(Change.NewValue);
+
+            if (Change.bReset)
+                break;
+
+            ReportHealthChange(FMath::RoundToInt(Change.NewValue) - FMath::RoundToInt(Change.OldValue));
+
+            if (Change.OldValue > 0.0f && Change.NewValue <= 0.0f)
             {
-                // Moving down
-                GetSprite()->SetFlipbook(WalkDownFlipbook);
+                OnHealthDepleted();
             }
         }
+        break;
+
+    case EAttribute::MoveSpeed:
+        GetCharacterMovement()->MaxWalkSpeed = Change.NewValue;
+        break;
+
+    default:
+        break;
+    }
+}
+
+void APaperBase::OnHealthDepleted()
+{
+    die(itemDrops, itemDropAmounts);
+}
+
+UPaperFlipbook* APaperBase::GetDirectionalFlipbook(EPaperAnimState State, EPaperFacing Facing) const
+{
+    const bool bSide = Facing == EPaperFacing::Left || Facing == EPaperFacing::Right;
+
+    switch (State)
+    {
+    case EPaperAnimState::Walk:
+        return bSide ? WalkSideFlipbook : (Facing == EPaperFacing::Up ? WalkUpFlipbook : WalkDownFlipbook);
+    case EPaperAnimState::Attack:
+        return bSide ? AttackSideFlipbook : (Facing == EPaperFacing::Up ? AttackUpFlipbook : AttackDownFlipbook);
+    case EPaperAnimState::Idle:
+        return IdleFlipbook;
+    default:
+        return nullptr;
     }
 }
 
@@ -113,14 +141,10 @@ float APaperBase::TakeDamage(float DamageAmount, FDamageEvent const& DamageEvent
 
 void APaperBase::TakeAHit(int32 damageAmount)
 {
-    health -= damageAmount;
-    
-    UE_LOG(LogTemp, Warning, TEXT("%s took %d damage. Health: %d"), *GetName(), damageAmount, health);
-    
-    if (health <= 0)
-    {
-        die(itemDrops, itemDropAmounts);
-    }
+    UE_LOG(LogTemp, Warning, TEXT("%s took %d damage. Health: %d"), *GetName(), damageAmount, Attributes->GetHealth() - damageAmount);
+
+    // Combat text and death (OnHealthDepleted) follow from the attribute change
+    Attributes->ApplyDelta(EAttribute::Health, -damageAmount);
 }
 
 void APaperBase::die(TArray<FName> drops, TArray<int32> amounts)
@@ -6,6 +6,8 @@
 #include "PaperCharacter.h"
 #include "CoreMinimal.h"
 #include "PaperFlipbookComponent.h"
+#include "SpriteAnimationSubsystem.h"
+#include "AttributeComponent.h"
 #include "PaperBase.generated.h"
 
 class USceneComponent;
@@ -29,6 +31,8 @@ protected:
 	// Called when the game starts or when spawned
 	virtual void BeginPlay();
 
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 public:
 	// Called every frame
 	virtual void Tick(float DeltaTime);
@@ -64,15 +68,28 @@ public:
 
 	bool bHasMoved = false;
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stats")
+	// Runtime health, defense, attack and move speed
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Stats")
+	UAttributeComponent* Attributes;
+
+	// Starting health; mirrors the Health attribute at runtime (change it through Attributes)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Stats")
 	int health = 10;
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stats")
 	int moveSpeed = 0;
 
-	void UpdateAnimation();
 	bool bIsMoving = false;
 
+	// Flipbook for a state / facing pair, or nullptr if this actor has none (side flipbooks are mirrored for Left)
+	virtual UPaperFlipbook* GetDirectionalFlipbook(EPaperAnimState State, EPaperFacing Facing) const;
+
+	// Slot in USpriteAnimationSubsystem, INDEX_NONE while unregistered
+	int32 AnimationIndex = INDEX_NONE;
+
+	// Slot in USignificanceSubsystem, INDEX_NONE while unregistered
+	int32 SignificanceIndex = INDEX_NONE;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Loot")
 	TArray<FName> itemDrops;
 
@@ -85,7 +102,17 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Combat")
 	void die(TArray<FName> drops, TArray<int32> amounts);
 
-	float cameraDistance;
+	// Push a health change to the floating combat text (negative = damage, positive = heal)
+	void ReportHealthChange(int32 Delta);
 
-	int lastHP;
+protected:
+	// Combat text, death and movement speed all follow the attribute events
+	virtual void HandleAttributeChanged(const FAttributeChange& Change);
+
+	// Health went from above zero to zero or below through gameplay
+	virtual void OnHealthDepleted();
+
+public:
+
+	float cameraDistance;
 };
@@ -15,11 +15,15 @@
 #include "InventoryWidget.h"
 #include "PlayerUIWidget.h"
 #include "SaveGameManager.h"
+#include "IslandPreloadSubsystem.h"
+#include "IslandGameMode.h"
+#include "InventoryComponent.h"
 
 // In constructor, initialize quick slots to 5 empty entries
 APaperChar::APaperChar()
 {
     PrimaryActorTick.bCanEverTick = true;
+    PrimaryActorTick.bStartWithTickEnabled = true;
 
     Camera = CreateDefaultSubobject<UCameraComponent>(TEXT("Camera"));
     Camera->SetupAttachment(RootComponent);
@@ -28,6 +32,8 @@ APaperChar::APaperChar()
 
     AutoPossessPlayer = EAutoReceiveInput::Player0;
 
+    Inventory = CreateDefaultSubobject<UInventoryComponent>(TEXT("Inventory"));
+
     EquippedWeapon = nullptr;
     LastAttackTime = 0.0f;
     bCanAttack = true;
@@ -65,14 +71,34 @@ void APaperChar::BeginPlay()
         }
     }
 
-    // Initialize the item database
-    if (ItemDataTable)
+    // Initialize the item database; the table is only loaded when neither the catalog nor an earlier level built it
+    UItemDatabase* ItemDatabase = UItemDatabase::Get(this);
+    if (ItemDatabase->GetNumItems() == 0 && !ItemDataTable.IsNull())
+    {
+        ItemDatabase->InitializeFromTable(ItemDataTable.LoadSynchronous());
+    }
+
+    if (ItemDatabase->GetNumItems() > 0)
     {
-        UItemDatabase::Get(this)->Initialize(ItemDataTable);
+        // Stream every weapon blueprint now so equipping never hitches
+        if (UIslandPreloadSubsystem* Preloader = UIslandPreloadSubsystem::Get(this))
+        {
+            Preloader->PreloadItemWeapons();
+        }
     }
     else
     {
-        UE_LOG(LogTemp, Error, TEXT("ItemDataTable not assigned in PaperChar Blueprint!"));
+        UE_LOG(LogTemp, Error, TEXT("No item catalog, and ItemDataTable is not assigned (or failed to load) in the PaperChar Blueprint!"));
+    }
+
+    // Seed the Defense / Attack attributes from the base stats
+    RecalculateStats();
+
+    // Inventory consumers react to the batched deltas instead of rescanning
+    Inventory->OnInventoryChanged.AddUObject(this, &APaperChar::HandleInventoryChanged);
+    if (USaveGameManager* SaveManager = USaveGameManager::Get(this))
+    {
+        Inventory->OnInventoryChanged.AddUObject(SaveManager, &USaveGameManager::HandleInventoryChanged);
     }
 
 
@@ -88,8 +114,8 @@ void APaperChar::BeginPlay()
 
 			UE_LOG(LogTemp, Log, TEXT("PlayerUIWidget created."));
 
-			// Initialize health display
-			PlayerUIWidget->SetHealthText(health);
+			// Initialize health display; later changes arrive through HandleAttributeChanged
+			PlayerUIWidget->SetHealthText(Attributes->GetHealth());
 
 			// Initialize quick slots display via helper
 			RefreshQuickSlots();
@@ -105,12 +131,11 @@ void APaperChar::BeginPlay()
 		if (!PlayerUIClass) UE_LOG(LogTemp, Warning, TEXT("PlayerUIClass not set on APaperChar"));
 	}
 
-    // Auto-load save if it exists
-    USaveGameManager* SaveManager = USaveGameManager::Get(this);
-    if (SaveManager && SaveManager->DoesSaveExist(TEXT("PlayerSaveSlot")))
+    // Take over the state carried from the previous level, or auto-load the newest of the save and
+    // the autosaves (it has been reading since the game instance started); applied next tick either way
+    if (USaveGameManager* SaveManager = USaveGameManager::Get(this))
     {
-        SaveManager->LoadGame(this, TEXT("PlayerSaveSlot"));
-        UE_LOG(LogTemp, Log, TEXT("Save game auto-loaded"));
+        SaveManager->LoadGameDeferred(this, SaveManager->GetStartupSlot());
     }
 }
 
@@ -120,22 +145,6 @@ void APaperChar::Tick(float DeltaTime)
     UpdateWeaponRotation();
 
 	FacingDirection = FVector2D(GetVelocity().GetSafeNormal2D());
-
-	// Handle attack cooldown
-    if (!bCanAttack)
-    {
-        float CurrentTime = GetWorld()->GetTimeSeconds();
-        if (CurrentTime - LastAttackTime >= 1.0f) // 1 second cooldown
-        {
-            bCanAttack = true;
-        }
-	}
-
-	// Sync health to UI (tick fallback)
-	if (PlayerUIWidget)
-	{
-		PlayerUIWidget->SetHealthText(health);
-	}
 }
 
 void APaperChar::SetupPlayerInputComponent(UInputComponent* PlayerInputComponent)
@@ -197,19 +206,19 @@ void APaperChar::OnInventoryInput()
 
 void APaperChar::ToggleInventory()
 {
+    APlayerController* PC = Cast<APlayerController>(GetController());
+
     if (bIsInventoryOpen)
     {
-        // Close inventory
+        // Close inventory; the widget is only hidden, so its list models live for the whole session
         if (InventoryWidget)
         {
-            InventoryWidget->RemoveFromParent();
-            InventoryWidget = nullptr;
+            InventoryWidget->SetVisibility(ESlateVisibility::Collapsed);
         }
 
         bIsInventoryOpen = false;
 
         // Re-enable player input
-        APlayerController* PC = Cast<APlayerController>(GetController());
         if (PC)
         {
             PC->SetInputMode(FInputModeGameOnly());
@@ -219,38 +228,46 @@ void APaperChar::ToggleInventory()
     else
     {
         // Open inventory
-        if (InventoryWidgetClass)
+        if (!PC)
         {
-            APlayerController* PC = Cast<APlayerController>(GetController());
-            if (!PC)
-            {
-                UE_LOG(LogTemp, Error, TEXT("Failed to get PlayerController"));
-                return;
-            }
+            UE_LOG(LogTemp, Error, TEXT("Failed to get PlayerController"));
+            return;
+        }
 
+        if (InventoryWidget)
+        {
+            // Rows were kept up to date by inventory deltas while hidden; equipment only refreshes while open
+            InventoryWidget->SetVisibility(ESlateVisibility::SelfHitTestInvisible);
+            InventoryWidget->RefreshEquipment();
+        }
+        else if (InventoryWidgetClass)
+        {
+            // Created on the first open only
             InventoryWidget = CreateWidget<UInventoryWidget>(PC, InventoryWidgetClass); // Create with PC, not World
             if (InventoryWidget)
             {
                 InventoryWidget->SetOwningCharacter(this);
                 InventoryWidget->AddToViewport();
-
-                // FIXED: Set input mode without SetWidgetToFocus
-                FInputModeGameAndUI InputMode;
-                InputMode.SetLockMouseToViewportBehavior(EMouseLockMode::DoNotLock);
-                PC->SetInputMode(InputMode);
-                PC->bShowMouseCursor = true;
-
-                bIsInventoryOpen = true;
             }
             else
             {
                 UE_LOG(LogTemp, Error, TEXT("Failed to create InventoryWidget"));
+                return;
             }
         }
         else
         {
             UE_LOG(LogTemp, Error, TEXT("InventoryWidgetClass is not set!"));
+            return;
         }
+
+        // FIXED: Set input mode without SetWidgetToFocus
+        FInputModeGameAndUI InputMode;
+        InputMode.SetLockMouseToViewportBehavior(EMouseLockMode::DoNotLock);
+        PC->SetInputMode(InputMode);
+        PC->bShowMouseCursor = true;
+
+        bIsInventoryOpen = true;
     }
 }
 
@@ -277,64 +294,20 @@ void APaperChar::UpdateWeaponRotation()
 
 void APaperChar::AddItemToInventory(FName ItemName, int Amount)
 {
-    UItemDatabase* DB = UItemDatabase::Get(this);
-    FItemData ItemData;
-
-    if (!DB->GetItemData(ItemName, ItemData))
+    const FItemId Id = UItemDatabase::Get(this)->FindItemId(ItemName);
+    if (!Id.IsValid())
     {
         UE_LOG(LogTemp, Warning, TEXT("Trying to add unknown item: %s"), *ItemName.ToString());
         return;
     }
 
-    // Handle based on item type
-    switch (ItemData.ItemType)
-    {
-    case EItemType::Material:
-    case EItemType::Consumable:
-    case EItemType::Placeable:
-    case EItemType::Armor:        
-        // Stackable items go into material inventory
-        if (MaterialInventory.Contains(ItemName))
-        {
-            MaterialInventory[ItemName] = FMath::Min(
-                MaterialInventory[ItemName] + Amount,
-                ItemData.MaxStackSize
-            );
-        }
-        else
-        {
-            MaterialInventory.Add(ItemName, FMath::Min(Amount, ItemData.MaxStackSize));
-        }
-        break;
-
-    case EItemType::Weapon:
-        // Weapons go into weapon inventory
-        for (int i = 0; i < Amount; ++i)
-        {
-            WeaponInventory.Add(ItemName);
-        }
-        break;
-    }
+    // Stackables are clamped to MaxStackSize, weapons are added as individual instances
+    Inventory->AddItem(Id, Amount);
 }
 
 int APaperChar::GetItemCount(FName ItemName) const
 {
-    if (MaterialInventory.Contains(ItemName))
-    {
-        return MaterialInventory[ItemName];
-    }
-
-    // Count weapons
-    int WeaponCount = 0;
-    for (const FName& WeaponName : WeaponInventory)
-    {
-        if (WeaponName == ItemName)
-        {
-            WeaponCount++;
-        }
-    }
-
-    return WeaponCount;
+    return Inventory->GetCount(UItemDatabase::Get(this)->FindItemId(ItemName));
 }
 
 bool APaperChar::HasItem(FName ItemName, int Amount) const
@@ -344,52 +317,25 @@ bool APaperChar::HasItem(FName ItemName, int Amount) const
 
 bool APaperChar::RemoveItem(FName ItemName, int Amount)
 {
-    if (!HasItem(ItemName, Amount))
-    {
-        return false;
-    }
-
-    if (MaterialInventory.Contains(ItemName))
-    {
-        MaterialInventory[ItemName] -= Amount;
-        if (MaterialInventory[ItemName] <= 0)
-        {
-            MaterialInventory.Remove(ItemName);
-        }
-        return true;
-    }
-
-    // Remove from weapon inventory
-    int RemovedCount = 0;
-    for (int i = WeaponInventory.Num() - 1; i >= 0 && RemovedCount < Amount; --i)
-    {
-        if (WeaponInventory[i] == ItemName)
-        {
-            WeaponInventory.RemoveAt(i);
-            RemovedCount++;
-        }
-    }
-
-    return RemovedCount == Amount;
+    return Inventory->RemoveItem(UItemDatabase::Get(this)->FindItemId(ItemName), Amount);
 }
 
 bool APaperChar::CanCraftItem(FName ItemName) const
 {
-    return UItemDatabase::Get(const_cast<APaperChar*>(this))->CanCraftItem(ItemName, MaterialInventory);
+    return Inventory->CanCraft(UItemDatabase::Get(this)->FindItemId(ItemName));
 }
 
 bool APaperChar::CraftItem(FName ItemName)
 {
     UItemDatabase* DB = UItemDatabase::Get(this);
-    FItemData ItemData;
-
-    if (!DB->GetItemData(ItemName, ItemData))
+    const FItemData* ItemData = DB->FindItem(ItemName);
+    if (!ItemData)
     {
         UE_LOG(LogTemp, Warning, TEXT("Item '%s' not found in database"), *ItemName.ToString());
         return false;
     }
 
-    if (!ItemData.bIsCraftable)
+    if (!ItemData->bIsCraftable)
     {
         UE_LOG(LogTemp, Warning, TEXT("Item '%s' is not craftable"), *ItemName.ToString());
         return false;
@@ -402,20 +348,27 @@ bool APaperChar::CraftItem(FName ItemName)
     }
 
     // Consume materials
-    for (const FCraftingRequirement& Requirement : ItemData.CraftingRequirements)
+    const FItemId RecipeId = DB->FindItemId(ItemName);
+    for (const FItemRequirement& Requirement : DB->GetRequirements(RecipeId))
     {
-        RemoveItem(Requirement.ItemName, Requirement.Amount);
+        Inventory->RemoveItem(Requirement.ItemId, Requirement.Amount, EInventoryChangeReason::Crafted);
     }
 
     // Add crafted item to inventory
-    AddItemToInventory(ItemName, 1);
+    Inventory->AddItem(RecipeId, 1, EInventoryChangeReason::Crafted);
+
+    if (USaveGameManager* SaveManager = USaveGameManager::Get(this))
+    {
+        SaveManager->RequestAutosave(EAutosaveTrigger::Craft);
+    }
 
     return true;
 }
 
 void APaperChar::EquipWeapon(int InventoryIndex)
 {
-    if (!WeaponInventory.IsValidIndex(InventoryIndex))
+    const FItemId WeaponId = Inventory->GetWeaponAt(InventoryIndex);
+    if (!WeaponId.IsValid())
     {
         UE_LOG(LogTemp, Warning, TEXT("Invalid weapon inventory index: %d"), InventoryIndex);
         return;
@@ -424,29 +377,39 @@ void APaperChar::EquipWeapon(int InventoryIndex)
     UnequipWeapon();
 
     // Get weapon data from database
-    FName WeaponName = WeaponInventory[InventoryIndex];
-    UItemDatabase* DB = UItemDatabase::Get(this);
-    FItemData ItemData;
-
-    if (!DB->GetItemData(WeaponName, ItemData))
+    const FItemData* ItemData = UItemDatabase::Get(this)->GetItem(WeaponId);
+    const FName WeaponName = ItemData ? ItemData->ItemName : NAME_None;
+    if (!ItemData)
     {
         UE_LOG(LogTemp, Error, TEXT("Weapon '%s' not found in database"), *WeaponName.ToString());
         return;
     }
 
-    if (ItemData.ItemType != EItemType::Weapon || !ItemData.WeaponClass)
+    if (ItemData->ItemType != EItemType::Weapon || ItemData->WeaponClass.IsNull())
     {
         UE_LOG(LogTemp, Error, TEXT("Item '%s' is not a valid weapon"), *WeaponName.ToString());
         return;
     }
 
+    // Weapon classes are kept resident by the preloader; only a cold start should ever miss
+    TSubclassOf<AWeaponBase> WeaponClass = ItemData->WeaponClass.Get();
+    if (!WeaponClass)
+    {
+        UE_LOG(LogTemp, Log, TEXT("Weapon class for '%s' was not preloaded, loading synchronously"), *WeaponName.ToString());
+        WeaponClass = ItemData->WeaponClass.LoadSynchronous();
+        if (!WeaponClass)
+        {
+            return;
+        }
+    }
+
     // Spawn weapon
     FActorSpawnParameters SpawnParams;
     SpawnParams.Owner = this;
     SpawnParams.Instigator = GetInstigator();
 
     EquippedWeapon = GetWorld()->SpawnActor<AWeaponBase>(
-        ItemData.WeaponClass,
+        WeaponClass,
         FVector::ZeroVector,
         FRotator::ZeroRotator,
         SpawnParams
@@ -462,14 +425,13 @@ void APaperChar::EquipWeapon(int InventoryIndex)
         EquippedWeapon->SetActorRelativeLocation(WeaponRelativeLocation);
         EquippedWeapon->SetActorRelativeRotation(WeaponRelativeRotation);
 
-        // Store the name and refresh stats
+        // The weapon replaces the unarmed attack as the Attack base; buffs stay on top
         EquippedWeaponName = WeaponName;
-        RecalculateStats();
+        Attributes->SetValue(EAttribute::Attack, EquippedWeapon->Damage);
 
-        // Refresh the UI if it's open
-        if (InventoryWidget && bIsInventoryOpen)
+        if (USaveGameManager* SaveManager = USaveGameManager::Get(this))
         {
-            InventoryWidget->RefreshEquipment();
+            SaveManager->HandleEquipmentChanged(this);
         }
     }
 }
@@ -482,13 +444,8 @@ void APaperChar::UnequipWeapon()
         EquippedWeapon = nullptr;
         EquippedWeaponName = NAME_None;
 
-        RecalculateStats();
-
-        // Refresh the UI if it's open
-        if (InventoryWidget && bIsInventoryOpen)
-        {
-            InventoryWidget->RefreshEquipment();
-        }
+        // Back to unarmed; the stats panel follows the attribute event
+        Attributes->SetValue(EAttribute::Attack, BaseAttack);
     }
 }
 
@@ -565,29 +522,29 @@ void APaperChar::Attack()
         PerformUnarmedAttack();
     }
 
-    // Reset and play weapon attack flipbook
-    GetSprite()->SetFlipbook(nullptr);
-
-    if (FacingDirection.Y > 0.f)
+    // Play the attack flipbook for the aimed direction (same dominant-axis rule as walking)
+    if (USpriteAnimationSubsystem* Animation = USpriteAnimationSubsystem::Get(this))
     {
-        GetSprite()->SetFlipbook(AttackUpFlipbook);
+        Animation->PlayDirectional(this, EPaperAnimState::Attack, USpriteAnimationSubsystem::ResolveFacing(FVector(FacingDirection, 0.f)));
     }
-    else if (FacingDirection.Y < 0.f)
+
+    LastAttackTime = CurrentTime;
+    bCanAttack = false;
+
+    // 1 second lockout before moving / attacking again
+    if (UTimerWheelSubsystem* Timers = UTimerWheelSubsystem::Get(this))
     {
-        GetSprite()->SetFlipbook(AttackDownFlipbook);
+        Timers->SetTimer(AttackLockoutHandle, this, &APaperChar::OnAttackLockoutExpired, 1.0f);
     }
     else
     {
-        GetSprite()->SetFlipbook(AttackSideFlipbook);
-        if (FacingDirection.X < 0.f)
-        {
-            // Flip sprite for left attack
-            GetSprite()->SetRelativeScale3D(FVector(-1.f, 1.f, 1.f));
-        }
+        bCanAttack = true;
     }
+}
 
-    LastAttackTime = CurrentTime;
-    bCanAttack = false;
+void APaperChar::OnAttackLockoutExpired()
+{
+    bCanAttack = true;
 }
 
 void APaperChar::PerformUnarmedAttack()
@@ -636,15 +593,13 @@ void APaperChar::AssignQuickSlot(int SlotIndex, FName ItemName)
 	UItemDatabase* DB = UItemDatabase::Get(this);
 	if (DB)
 	{
-		FItemData ItemData;
-		if (DB->GetItemData(ItemName, ItemData))
+		const FItemData* ItemData = DB->FindItem(ItemName);
+
+		// Block armor being added to quick slots programmatically
+		if (ItemData && ItemData->ItemType == EItemType::Armor)
 		{
-			// Block armor being added to quick slots programmatically
-			if (ItemData.ItemType == EItemType::Armor)
-			{
-				UE_LOG(LogTemp, Warning, TEXT("Cannot assign Armor to Quick Slots."));
-				return;
-			}
+			UE_LOG(LogTemp, Warning, TEXT("Cannot assign Armor to Quick Slots."));
+			return;
 		}
 	}
 
@@ -702,53 +657,59 @@ void APaperChar::UseQuickSlot(int SlotIndex)
 	if (!DB)
 		return;
 
-	FItemData ItemData;
-	if (!DB->GetItemData(ItemName, ItemData))
+	const FItemData* ItemData = DB->FindItem(ItemName);
+	if (!ItemData)
 		return;
 
-	switch (ItemData.ItemType)
+	switch (ItemData->ItemType)
 	{
 	case EItemType::Weapon:
 		{
 			// Find this weapon in weapon inventory and equip first instance
-			for (int i = 0; i < WeaponInventory.Num(); ++i)
+			const FItemId WeaponId = DB->FindItemId(ItemName);
+			const int32 WeaponIndex = Inventory->FindWeaponIndex(WeaponId);
+			if (WeaponIndex != INDEX_NONE)
 			{
-				if (WeaponInventory[i] == ItemName)
-				{
-					EquipWeapon(i);
-					return;
-				}
+				EquipWeapon(WeaponIndex);
+				return;
 			}
 
 			// If not present in weapon inventory, add it and equip
-			AddItemToInventory(ItemName, 1);
-			EquipWeapon(WeaponInventory.Num() - 1);
+			Inventory->AddItem(WeaponId, 1);
+			EquipWeapon(Inventory->GetWeapons().Num() - 1);
 		}
 		break;
 
 	case EItemType::Consumable:
 		{
 			// Consume one and apply simple effect (example: heal 10)
-			if (RemoveItem(ItemName, 1))
+			// Using the last one frees the slot via HandleInventoryChanged
+			if (Inventory->RemoveItem(DB->FindItemId(ItemName), 1, EInventoryChangeReason::Consumed))
 			{
-				health += 10; // simple heal example
-				if (health < 0) health = 0;
-				
-				// Update UI health immediately
-				if (PlayerUIWidget) PlayerUIWidget->SetHealthText(health);
-
-				// CHECK IF THIS WAS THE EXACT LAST ITEM WE HAD
-				if (GetItemCount(ItemName) <= 0)
-				{
-					QuickSlots[SlotIndex] = NAME_None;
-					RefreshQuickSlots();
-				}
+				// Simple heal example; the HUD and combat text follow the attribute event
+				Attributes->SetValue(EAttribute::Health, FMath::Max(0, Attributes->GetHealth() + 10));
 			}
 		}
 		break;
 
-	case EItemType::Material:
 	case EItemType::Placeable:
+		{
+			// Put it down in front of the player; the island game mode saves it with the island
+			AIslandGameMode* GameMode = GetWorld()->GetAuthGameMode<AIslandGameMode>();
+			const FItemId PlaceableId = DB->FindItemId(ItemName);
+			if (!GameMode || !Inventory->HasItem(PlaceableId, 1))
+				break;
+
+			const FVector Facing = FacingDirection.IsNearlyZero() ? GetActorForwardVector() : FVector(FacingDirection, 0.0f);
+			const FVector Location = GetActorLocation() + Facing * PlaceDistance;
+			if (GameMode->PlaceObject(ItemName, Location, Facing.Rotation().Yaw))
+			{
+				Inventory->RemoveItem(PlaceableId, 1, EInventoryChangeReason::Consumed);
+			}
+		}
+		break;
+
+	case EItemType::Material:
 	default:
 		// No default action; you can implement blueprint override or expand behavior
 		UE_LOG(LogTemp, Log, TEXT("Used quick slot item: %s (no default action)"), *ItemName.ToString());
@@ -789,51 +750,50 @@ void APaperChar::RefreshQuickSlots()
 		return;
 
 	UItemDatabase* DB = UItemDatabase::Get(this);
+	static const FItemData EmptySlot;
 	for (int i = 0; i < QuickSlots.Num(); ++i)
 	{
-		FItemData ItemData;
-		if (DB && DB->GetItemData(QuickSlots[i], ItemData))
-		{
-			PlayerUIWidget->SetQuickSlot(i, ItemData);
-		}
-		else
-		{
-			// Pass an empty struct to clear slot
-			PlayerUIWidget->SetQuickSlot(i, FItemData());
-		}
+		// Empty slots get the default struct, which clears the icon
+		const FItemData* ItemData = DB ? DB->FindItem(QuickSlots[i]) : nullptr;
+		PlayerUIWidget->SetQuickSlot(i, ItemData ? *ItemData : EmptySlot);
 	}
 }
 
 void APaperChar::EquipArmor(FName ArmorItemName)
 {
-    if (!ItemDataTable) return;
-
     // Find the item
-    FString ContextString;
-    FItemData* ItemData = ItemDataTable->FindRow<FItemData>(ArmorItemName, ContextString);
+    UItemDatabase* DB = UItemDatabase::Get(this);
+    const FItemData* ItemData = DB->FindItem(ArmorItemName);
 
     if (ItemData && ItemData->ItemType == EItemType::Armor)
     {
+        // Take it out of the standard inventory first; armor we don't own can't be worn
+        if (!Inventory->RemoveItem(DB->FindItemId(ArmorItemName), 1, EInventoryChangeReason::Equipped))
+        {
+            UE_LOG(LogTemp, Warning, TEXT("Cannot equip '%s': not in inventory"), *ArmorItemName.ToString());
+            return;
+        }
+
         // Unequip currently equipped armor in that slot first (Refund to inventory)
         if (EquippedArmor.Contains(ItemData->ArmorSlot))
         {
             FName OldArmor = EquippedArmor[ItemData->ArmorSlot];
-            AddItemToInventory(OldArmor, 1);
+            Inventory->AddItem(DB->FindItemId(OldArmor), 1, EInventoryChangeReason::Unequipped);
         }
 
-        // Equip new armor
+        // Equip new armor; its modifier replaces the previous piece's in the same slot
         EquippedArmor.Add(ItemData->ArmorSlot, ArmorItemName);
+        Attributes->AddModifier(GetArmorModifierSource(ItemData->ArmorSlot), EAttribute::Defense, EAttributeModOp::Flat, ItemData->DefenseValue);
 
-        // Remove from standard inventory 
-        RemoveItem(ArmorItemName, 1);
-
-        // Refresh stats math
-        RecalculateStats();
-
-        // Refresh the open UI!
+        // Inventory rows follow the deltas; only the equipment panel needs a push
         if (InventoryWidget && bIsInventoryOpen)
         {
-            InventoryWidget->RefreshInventory(); // Call full refresh to move the item from scrollbox to equip slot
+            InventoryWidget->RefreshEquipment();
+        }
+
+        if (USaveGameManager* SaveManager = USaveGameManager::Get(this))
+        {
+            SaveManager->HandleEquipmentChanged(this);
         }
     }
 }
@@ -843,82 +803,136 @@ void APaperChar::UnequipArmor(EArmorSlot SlotIndex)
     if (EquippedArmor.Contains(SlotIndex))
     {
         FName ArmorToUnequip = EquippedArmor[SlotIndex];
-        AddItemToInventory(ArmorToUnequip, 1); // Give it back to the player
+        Inventory->AddItem(UItemDatabase::Get(this)->FindItemId(ArmorToUnequip), 1, EInventoryChangeReason::Unequipped); // Give it back to the player
         EquippedArmor.Remove(SlotIndex);
-        
-        // Refresh stats math
-        RecalculateStats();
+        Attributes->RemoveModifiers(GetArmorModifierSource(SlotIndex));
 
         // Refresh the open UI
         if (InventoryWidget && bIsInventoryOpen)
         {
-            InventoryWidget->RefreshInventory();
+            InventoryWidget->RefreshEquipment();
+        }
+
+        if (USaveGameManager* SaveManager = USaveGameManager::Get(this))
+        {
+            SaveManager->HandleEquipmentChanged(this);
         }
     }
 }
 
+FName APaperChar::GetArmorModifierSource(EArmorSlot ArmorSlot)
+{
+    // Numbered FName ("Armor_1".."Armor_4"), no string building
+    return FName(TEXT("Armor"), (int32)ArmorSlot + 1);
+}
+
 void APaperChar::RecalculateStats()
 {
-    TotalDefense = BaseDefense;
+    // Full resync for spawn / save load; equips and unequips only touch their own modifier
+    Attributes->SetValue(EAttribute::Defense, BaseDefense);
+    Attributes->SetValue(EAttribute::Attack, EquippedWeapon ? EquippedWeapon->Damage : BaseAttack);
 
     UItemDatabase* DB = UItemDatabase::Get(this);
-    if (!DB) return;
+    for (EArmorSlot ArmorSlot : { EArmorSlot::Head, EArmorSlot::Chest, EArmorSlot::Legs, EArmorSlot::Boots })
+    {
+        const FName* ArmorName = EquippedArmor.Find(ArmorSlot);
+        const FItemData* ArmorData = ArmorName && DB ? DB->FindItem(*ArmorName) : nullptr;
+        if (ArmorData)
+        {
+            Attributes->AddModifier(GetArmorModifierSource(ArmorSlot), EAttribute::Defense, EAttributeModOp::Flat, ArmorData->DefenseValue);
+        }
+        else
+        {
+            Attributes->RemoveModifiers(GetArmorModifierSource(ArmorSlot));
+        }
+    }
+}
 
-    // Calculate Armor Defense
-    for (const auto& ArmorPair : EquippedArmor)
+void APaperChar::HandleAttributeChanged(const FAttributeChange& Change)
+{
+    Super::HandleAttributeChanged(Change);
+
+    switch (Change.Attribute)
     {
-        FItemData ArmorData;
-        if (DB->GetItemData(ArmorPair.Value, ArmorData))
+    case EAttribute::Health:
+        if (PlayerUIWidget)
         {
-            TotalDefense += ArmorData.DefenseValue;
+            PlayerUIWidget->SetHealthText(FMath::RoundToInt(Change.NewValue));
         }
+        break;
+
+    case EAttribute::Defense:
+    case EAttribute::Attack:
+        TotalDefense = Attributes->GetValue(EAttribute::Defense);
+        TotalAttack = Attributes->GetValue(EAttribute::Attack);
+
+        if (InventoryWidget && bIsInventoryOpen)
+        {
+            InventoryWidget->RefreshEquipment();
+        }
+        break;
+
+    default:
+        break;
     }
+}
 
-    // Set Attack Power strictly from the equipped weapon, or fall back to BaseAttack if unarmed
-    if (EquippedWeapon)
+void APaperChar::OnHealthDepleted()
+{
+    TArray<FName> emptyDrops;
+    TArray<int> emptyAmounts;
+    die(emptyDrops, emptyAmounts);
+}
+
+void APaperChar::HandleInventoryChanged(TArrayView<const FInventoryDelta> Deltas)
+{
+    UItemDatabase* DB = UItemDatabase::Get(this);
+    if (!DB)
+        return;
+
+    bool bQuickSlotsChanged = false;
+    for (const FInventoryDelta& Delta : Deltas)
     {
-        TotalAttack = EquippedWeapon->Damage;
+        // Only an explicit use / delete frees the slot; weapons can sit in a slot without being owned
+        const bool bUsedUp = Delta.NewCount == 0
+            && (Delta.Reason == EInventoryChangeReason::Consumed || Delta.Reason == EInventoryChangeReason::Removed);
+        if (!bUsedUp)
+            continue;
+
+        const FName ItemName = DB->GetItemName(Delta.ItemId);
+        for (FName& QuickSlot : QuickSlots)
+        {
+            if (QuickSlot == ItemName)
+            {
+                QuickSlot = NAME_None;
+                bQuickSlotsChanged = true;
+            }
+        }
     }
-    else
+
+    if (bQuickSlotsChanged)
     {
-        TotalAttack = BaseAttack; // Unarmed Damage
+        RefreshQuickSlots();
     }
-    
-    // Log it out to prove the math is working behind the scenes
-    UE_LOG(LogTemp, Log, TEXT("Recalculated Stats - Attack: %f | Defense: %f"), TotalAttack, TotalDefense);
 }
 
 void APaperChar::TakeAHit(int damageAmount)
 {
 	// Calculate how much damage to block based on defense
-	int MitigatedDamage = damageAmount - FMath::RoundToInt(TotalDefense);
+	const float Defense = Attributes->GetValue(EAttribute::Defense);
+	int MitigatedDamage = damageAmount - FMath::RoundToInt(Defense);
 
 	// Ensure the player takes at least 1 damage from attacks, so they can't be fully invincible
 	MitigatedDamage = FMath::Max(1, MitigatedDamage);
 
-	// Apply the blocked damage to health
-	health -= MitigatedDamage;
-	
 	// Prevent health from going below zero
-	if (health < 0) health = 0;
-
-	// Update health display immediately
-	if (PlayerUIWidget)
-	{
-		PlayerUIWidget->SetHealthText(health);
-	}
+	const int NewHealth = FMath::Max(0, Attributes->GetHealth() - MitigatedDamage);
 
 	UE_LOG(LogTemp, Log, TEXT("Raw Damage: %d | Defense: %f | Took Damage: %d | Current Health: %d"), 
-		damageAmount, TotalDefense, MitigatedDamage, health);
-		
-	
-	if (health <= 0)
-	{
-		
-		TArray<FName> emptyDrops;
-		TArray<int> emptyAmounts;
-		die(emptyDrops, emptyAmounts); 
-	}
+		damageAmount, Defense, MitigatedDamage, NewHealth);
+
+	// HUD, combat text and death (OnHealthDepleted) follow from the attribute change
+	Attributes->SetValue(EAttribute::Health, NewHealth);
 }
 
 void APaperChar::SaveGame()
@@ -926,10 +940,11 @@ void APaperChar::SaveGame()
     USaveGameManager* SaveManager = USaveGameManager::Get(this);
     if (SaveManager)
     {
+        // Written in the background; the manager logs the result
         bool bSuccess = SaveManager->SaveGame(this, TEXT("PlayerSaveSlot"));
         if (bSuccess)
         {
-            UE_LOG(LogTemp, Log, TEXT("Game saved successfully"));
+            UE_LOG(LogTemp, Log, TEXT("Game save started"));
             // Optional: Show UI notification
         }
     }
@@ -959,7 +974,7 @@ void APaperChar::QuickSave()
     if (SaveManager)
     {
         SaveManager->SaveGame(this, TEXT("QuickSaveSlot"));
-        UE_LOG(LogTemp, Log, TEXT("Quick save completed"));
+        UE_LOG(LogTemp, Log, TEXT("Quick save started"));
     }
 }
 
@@ -9,6 +9,7 @@
 #include "PaperCharacter.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "InputActionValue.h"
+#include "TimerWheelSubsystem.h"
 #include "PaperChar.generated.h"
 
 class UInputMappingContext;
@@ -16,6 +17,8 @@ class UInputAction;
 class UCameraComponent;
 class UDataTable;
 class UPlayerUIWidget;
+class UInventoryComponent;
+struct FInventoryDelta;
 
 UCLASS()
 class BRIDGEANDBLADE_API APaperChar : public APaperBase
@@ -40,8 +43,9 @@ protected:
 
 	void PerformUnarmedAttack();
 
+	// Soft so packaged builds running off the baked catalog never load the table
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Database")
-	UDataTable* ItemDataTable;
+	TSoftObjectPtr<UDataTable> ItemDataTable;
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Movement")
 	FVector2D FacingDirection;
@@ -69,6 +73,10 @@ public:
 	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Category = "QuickSlots")
 	TArray<FName> QuickSlots;
 
+	// How far in front of the player a placeable item is put down
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "QuickSlots")
+	float PlaceDistance = 120.f;
+
 	UPROPERTY(EditAnywhere, Category = "Components")
 	UCameraComponent* Camera;
 
@@ -146,11 +154,9 @@ public:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Weapon")
 	FName EquippedWeaponName;
 
+	// Materials, consumables, armor and weapon instances, stored by dense item id
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Inventory")
-	TArray<FName> WeaponInventory;
-
-	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Category = "Inventory")
-	TMap<FName, int> MaterialInventory;
+	UInventoryComponent* Inventory;
 
 
 	// Inventory functions
@@ -185,6 +191,10 @@ public:
 	float LastAttackTime;
 	bool bCanAttack;
 
+	// Re-enables bCanAttack once the post-attack lockout expires
+	FWheelTimerHandle AttackLockoutHandle;
+	void OnAttackLockoutExpired();
+
 	UPROPERTY(EditAnywhere, Category = "Input")
 	UInputAction* InventoryAction;
 
@@ -207,6 +217,7 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Attributes")
 	float BaseDefense;
 
+	// Mirrors of the Defense / Attack attributes for Blueprints
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Attributes")
 	float TotalDefense;
 
@@ -227,12 +238,28 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Inventory|Armor")
 	void UnequipArmor(EArmorSlot SlotIndex);
 
+	// Rebuild the Defense / Attack base values and armor modifiers from scratch (spawn, save load)
 	UFUNCTION(BlueprintCallable, Category = "Attributes")
 	void RecalculateStats();
 
+	// Modifier source name used for the armor worn in ArmorSlot
+	static FName GetArmorModifierSource(EArmorSlot ArmorSlot);
+
+	// Frees quick slots of items the player used up or threw away
+	void HandleInventoryChanged(TArrayView<const FInventoryDelta> Deltas);
+
 	// Combat
 	virtual void TakeAHit(int damageAmount) override;
 
+protected:
+	// Pushes health to the HUD and stats to the inventory panel when they actually change
+	virtual void HandleAttributeChanged(const FAttributeChange& Change) override;
+
+	// The player has no loot table
+	virtual void OnHealthDepleted() override;
+
+public:
+
 	// Save/Load functions
 	UFUNCTION(BlueprintCallable, Category = "Save System")
 	void SaveGame();
@@ -8,7 +8,6 @@
 #include "GameFramework/DamageType.h"
 #include "PaperFlipbook.h"
 #include "PaperSpriteComponent.h"
-#include "TimerManager.h"
 #include "AIController.h"
 
 APaperEnemy::APaperEnemy()
@@ -23,25 +22,6 @@ void APaperEnemy::BeginPlay()
 	Super::BeginPlay();
 }
 
-void APaperEnemy::Tick(float DeltaTime)
-{
-	Super::Tick(DeltaTime);
-
-
-	if (CooldownRemaining > 0.0f)
-	{
-		CooldownRemaining -= DeltaTime;
-
-		GetSprite()->SetFlipbook(CurrentFlipbook);
-
-		UE_LOG(LogTemp, Log, TEXT("%s cooldown ticking down: %f seconds remaining"), *GetName(), CooldownRemaining);
-	}
-	else
-	{
-		CurrentFlipbook = GetSprite() ? GetSprite()->GetFlipbook() : nullptr;
-	}
-}
-
 bool APaperEnemy::CanAttack() const
 {
 	if (!GetWorld())
@@ -88,75 +68,26 @@ bool APaperEnemy::Attack(APawn* TargetPawn)
 	}
 
 	// Choose and play the appropriate wind-up flipbook (if provided), otherwise fall back to attack flipbook.
-	if (GetSprite())
+	if (USpriteAnimationSubsystem* Animation = USpriteAnimationSubsystem::Get(this))
 	{
-		const FVector Delta = TargetPawn->GetActorLocation() - GetActorLocation();
+		const EPaperFacing Facing = USpriteAnimationSubsystem::ResolveFacing(TargetPawn->GetActorLocation() - GetActorLocation());
 
-		// Decide which flipbook set to use based on dominant axis (consistent with PaperBase)
-		if (FMath::Abs(Delta.Y) > FMath::Abs(Delta.X))
-		{
-			// Side wind-up; flip X scale for left/right
-			if (Delta.Y > 0)
-			{
-				GetSprite()->SetRelativeScale3D(FVector(1.f, 1.f, 1.f));
-			}
-			else
-			{
-				GetSprite()->SetRelativeScale3D(FVector(-1.f, 1.f, 1.f));
-			}
-
-			// Play side windup if available, otherwise play side attack as a fallback
-			if (WindupSideFlipbook)
-			{
-				GetSprite()->SetFlipbook(WindupSideFlipbook);
-				GetSprite()->PlayFromStart();
-			}
-			else if (AttackSideFlipbook)
-			{
-				GetSprite()->SetFlipbook(AttackSideFlipbook);
-				GetSprite()->PlayFromStart();
-				CurrentFlipbook = AttackSideFlipbook;
-				CooldownRemaining = AttackCooldown;
-			}
-		}
-		else
+		if (!Animation->PlayDirectional(this, EPaperAnimState::Windup, Facing)
+			&& Animation->PlayDirectional(this, EPaperAnimState::Attack, Facing))
 		{
-			// Up / Down wind-up
-			if (Delta.X > 0)
-			{
-				if (WindupUpFlipbook)
-				{
-					GetSprite()->SetFlipbook(WindupUpFlipbook);
-					GetSprite()->PlayFromStart();
-				}
-				else if (AttackUpFlipbook)
-				{
-					GetSprite()->SetFlipbook(AttackUpFlipbook);
-					GetSprite()->PlayFromStart();
-					CurrentFlipbook = AttackUpFlipbook;
-					CooldownRemaining = AttackCooldown;
-				}
-			}
-			else
-			{
-				if (WindupDownFlipbook)
-				{
-					GetSprite()->SetFlipbook(WindupDownFlipbook);
-					GetSprite()->PlayFromStart();
-				}
-				else if (AttackDownFlipbook)
-				{
-					GetSprite()->SetFlipbook(AttackDownFlipbook);
-					GetSprite()->PlayFromStart();
-					CurrentFlipbook = AttackDownFlipbook;
-					CooldownRemaining = AttackCooldown;
-				}
-			}
+			HoldAttackPose();
 		}
 	}
 
 	// Schedule damage application after WindupTime
-	GetWorld()->GetTimerManager().SetTimer(WindupTimerHandle, this, &APaperEnemy::ExecuteAttack, WindupTime, false);
+	if (UTimerWheelSubsystem* Timers = UTimerWheelSubsystem::Get(this))
+	{
+		Timers->SetTimer(WindupTimerHandle, this, &APaperEnemy::ExecuteAttack, WindupTime);
+	}
+	else
+	{
+		ExecuteAttack();
+	}
 
 	UE_LOG(LogTemp, Log, TEXT("%s began wind-up to attack %s (windup=%f)"), *GetName(), *TargetPawn->GetName(), WindupTime);
 
@@ -175,46 +106,18 @@ void APaperEnemy::ExecuteAttack()
 	{
 		UE_LOG(LogTemp, Warning, TEXT("ExecuteAttack aborted: invalid target or world"));
 		// Optionally restore idle animation
-		if (GetSprite() && IdleFlipbook)
+		if (USpriteAnimationSubsystem* Animation = USpriteAnimationSubsystem::Get(this))
 		{
-			GetSprite()->SetFlipbook(IdleFlipbook);
+			Animation->PlayDirectional(this, EPaperAnimState::Idle, EPaperFacing::Down, false);
 		}
 		return;
 	}
 
 	// Play the actual attack flipbook (if available) when executing the hit
 	// We want to play this animation even if the hit will miss
-	if (GetSprite())
-	{
-		const FVector Delta = TargetPawn->GetActorLocation() - GetActorLocation();
-		if (FMath::Abs(Delta.Y) > FMath::Abs(Delta.X))
-		{
-			if (AttackSideFlipbook)
-			{
-				GetSprite()->SetFlipbook(AttackSideFlipbook);
-				GetSprite()->PlayFromStart();
-			}
-		}
-		else
-		{
-			if (Delta.X > 0)
-			{
-				if (AttackUpFlipbook)
-				{
-					GetSprite()->SetFlipbook(AttackUpFlipbook);
-					GetSprite()->PlayFromStart();
-				}
-			}
-			else
-			{
-				if (AttackDownFlipbook)
-				{
-					GetSprite()->SetFlipbook(AttackDownFlipbook);
-					GetSprite()->PlayFromStart();
-				}
-			}
-		}
-	}
+	USpriteAnimationSubsystem* Animation = USpriteAnimationSubsystem::Get(this);
+	const bool bPlayedAttack = Animation
+		&& Animation->PlayDirectional(this, EPaperAnimState::Attack, USpriteAnimationSubsystem::ResolveFacing(TargetPawn->GetActorLocation() - GetActorLocation()));
 
 	// Range check again just to decide IF we apply damage, BUT don't return entirely
 	const float DistSq = FVector::DistSquared(GetActorLocation(), TargetPawn->GetActorLocation());
@@ -230,19 +133,49 @@ void APaperEnemy::ExecuteAttack()
 		UE_LOG(LogTemp, Log, TEXT("%s executed attack on %s for %f damage"), *GetName(), *TargetPawn->GetName(), DamageAmount);
 	}
 
-	// Optionally revert to idle flipbook after attack finishes
-	if (GetSprite() && IdleFlipbook)
+	// Let the attack flipbook play; for simplicity we immediately set idle if no attack flipbook was present.
+	if (Animation && !bPlayedAttack)
+	{
+		Animation->PlayDirectional(this, EPaperAnimState::Idle, EPaperFacing::Down, false);
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("%s executed attack on %s for %f damage"), *GetName(), *TargetPawn->GetName(), DamageAmount);
+
+	// The wind-up timer has fired; drop the stale handle
+	WindupTimerHandle.Invalidate();
+}
+
+UPaperFlipbook* APaperEnemy::GetDirectionalFlipbook(EPaperAnimState State, EPaperFacing Facing) const
+{
+	if (State == EPaperAnimState::Windup)
 	{
-		// Let the attack flipbook play; for simplicity we immediately set idle if no attack flipbook was present.
-		if (!(AttackUpFlipbook || AttackDownFlipbook || AttackSideFlipbook))
+		if (Facing == EPaperFacing::Left || Facing == EPaperFacing::Right)
 		{
-			GetSprite()->SetFlipbook(IdleFlipbook);
+			return WindupSideFlipbook;
 		}
+		return Facing == EPaperFacing::Up ? WindupUpFlipbook : WindupDownFlipbook;
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("%s executed attack on %s for %f damage"), *GetName(), *TargetPawn->GetName(), DamageAmount);
+	return Super::GetDirectionalFlipbook(State, Facing);
+}
 
-	// clear timer handle in case
-	GetWorld()->GetTimerManager().ClearTimer(WindupTimerHandle);
+void APaperEnemy::HoldAttackPose()
+{
+	USpriteAnimationSubsystem* Animation = USpriteAnimationSubsystem::Get(this);
+	UTimerWheelSubsystem* Timers = UTimerWheelSubsystem::Get(this);
+	if (!Animation || !Timers)
+	{
+		return;
+	}
+
+	Animation->SetAnimationLocked(this, true);
+	Timers->SetTimer(AttackPoseTimerHandle, this, &APaperEnemy::ReleaseAttackPose, AttackCooldown);
 }
 
+void APaperEnemy::ReleaseAttackPose()
+{
+	if (USpriteAnimationSubsystem* Animation = USpriteAnimationSubsystem::Get(this))
+	{
+		Animation->SetAnimationLocked(this, false);
+	}
+}
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "PaperBase.h"
+#include "TimerWheelSubsystem.h"
 #include "PaperEnemy.generated.h"
 
 class APawn;
@@ -17,7 +18,9 @@ public:
 	APaperEnemy();
 
 	virtual void BeginPlay() override;
-	virtual void Tick(float DeltaTime) override;
+
+	// Adds the Windup* flipbooks on top of the base walk / attack / idle set
+	virtual UPaperFlipbook* GetDirectionalFlipbook(EPaperAnimState State, EPaperFacing Facing) const override;
 
 	// Expose wind-up state so controllers can respect it
 	bool IsWindingUp() const { return bIsWindingUp; }
@@ -64,7 +67,7 @@ private:
 	bool bIsWindingUp = false;
 
 	// Timer handle for windup
-	FTimerHandle WindupTimerHandle;
+	FWheelTimerHandle WindupTimerHandle;
 
 	// Target pawn stored during wind-up
 	TWeakObjectPtr<APawn> PendingTarget;
@@ -72,7 +75,8 @@ private:
 	// Called when wind-up finishes to apply the damage
 	void ExecuteAttack();
 
-	float CooldownRemaining = 0.0f;
-
-	UPaperFlipbook* CurrentFlipbook = nullptr;
+	// Hold the attack flipbook for AttackCooldown when there is no dedicated wind-up animation
+	FWheelTimerHandle AttackPoseTimerHandle;
+	void HoldAttackPose();
+	void ReleaseAttackPose();
 };
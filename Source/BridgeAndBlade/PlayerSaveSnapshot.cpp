@@ -0,0 +1,600 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "PlayerSaveSnapshot.h"
+#include "BridgeAndBladeSaveGame.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Kismet/GameplayStatics.h"
+#include "Misc/Compression.h"
+#include "Misc/Crc.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace
+{
+    constexpr uint32 SnapshotMagic = 0x56534242; // "BBSV"
+
+    // 1: name table, packed ints, built bridges as a bitset, per-island world state, play time;
+    //    selectable compression and a CRC of the payload. Bump on any layout change and keep a reader for the old one.
+    constexpr int32 SnapshotVersion = 1;
+
+    // Refuse to allocate for obviously broken headers
+    constexpr int32 MaxPayloadSize = 64 * 1024 * 1024;
+
+    enum class ESaveCompression : uint8
+    {
+        None,
+        Zlib,
+        LZ4,
+        Oodle,
+
+        Count
+    };
+
+    TAutoConsoleVariable<int32> CVarSaveCompression(
+        TEXT("SaveGame.Compression"),
+        (int32)ESaveCompression::Oodle,
+        TEXT("Compression for new save files: 0 none, 1 zlib, 2 LZ4, 3 Oodle"));
+
+    FName GetFormatName(ESaveCompression Compression)
+    {
+        switch (Compression)
+        {
+        case ESaveCompression::Zlib:  return NAME_Zlib;
+        case ESaveCompression::LZ4:   return NAME_LZ4;
+        case ESaveCompression::Oodle: return NAME_Oodle;
+        default:                      return NAME_None;
+        }
+    }
+
+    bool Compress(ESaveCompression Compression, const TArray<uint8>& Payload, TArray<uint8>& OutCompressed)
+    {
+        if (Compression == ESaveCompression::None)
+        {
+            OutCompressed = Payload;
+            return true;
+        }
+
+        const FName Format = GetFormatName(Compression);
+        int32 CompressedSize = FCompression::CompressMemoryBound(Format, Payload.Num());
+        OutCompressed.SetNumUninitialized(CompressedSize);
+        if (!FCompression::CompressMemory(Format, OutCompressed.GetData(), CompressedSize, Payload.GetData(), Payload.Num()))
+            return false;
+
+        OutCompressed.SetNum(CompressedSize);
+        return true;
+    }
+
+    bool Decompress(ESaveCompression Compression, const uint8* Data, int32 DataSize, TArray<uint8>& OutPayload)
+    {
+        if (Compression == ESaveCompression::None)
+        {
+            if (DataSize != OutPayload.Num())
+                return false;
+
+            FMemory::Memcpy(OutPayload.GetData(), Data, DataSize);
+            return true;
+        }
+
+        return FCompression::UncompressMemory(GetFormatName(Compression), OutPayload.GetData(), OutPayload.Num(), Data, DataSize);
+    }
+
+    // Signed values that are usually small and positive; zigzag keeps the packed form short
+    void SerializeSignedPacked(FArchive& Ar, int32& Value)
+    {
+        uint32 Encoded = ((uint32)Value << 1) ^ (uint32)(Value >> 31);
+        Ar.SerializeIntPacked(Encoded);
+        Value = (int32)(Encoded >> 1) ^ -(int32)(Encoded & 1);
+    }
+
+    // Every FName in the file is written once; the body refers to them by index. Index 0 is NAME_None.
+    struct FNameTable
+    {
+        TArray<FName> Names;
+        TMap<FName, uint32> Indices;
+
+        FNameTable()
+        {
+            Add(NAME_None);
+        }
+
+        uint32 Add(FName Name)
+        {
+            if (const uint32* Existing = Indices.Find(Name))
+                return *Existing;
+
+            const uint32 Index = Names.Add(Name);
+            Indices.Add(Name, Index);
+            return Index;
+        }
+
+        uint32 Get(FName Name) const
+        {
+            return Indices.FindChecked(Name);
+        }
+    };
+
+    // Reads an index and checks it against the table; flags the archive instead of indexing out of range
+    FName ReadName(FArchive& Ar, const TArray<FName>& Names)
+    {
+        uint32 Index = 0;
+        Ar.SerializeIntPacked(Index);
+        if (!Names.IsValidIndex(Index))
+        {
+            Ar.SetError();
+            return NAME_None;
+        }
+        return Names[Index];
+    }
+
+    uint32 ReadCount(FArchive& Ar)
+    {
+        uint32 Count = 0;
+        Ar.SerializeIntPacked(Count);
+
+        // Every entry takes at least a byte
+        if (Count > (uint32)(Ar.TotalSize() - Ar.Tell()))
+        {
+            Ar.SetError();
+            return 0;
+        }
+        return Count;
+    }
+}
+
+FPlayerSaveSnapshot FPlayerSaveSnapshot::FromLegacy(const UBridgeAndBladeSaveGame& SaveGame)
+{
+    FPlayerSaveSnapshot Snapshot;
+    Snapshot.PlayerLocation = SaveGame.PlayerLocation;
+    Snapshot.PlayerRotation = SaveGame.PlayerRotation;
+    Snapshot.CurrentLevelName = SaveGame.CurrentLevelName;
+    Snapshot.PlayerHealth = SaveGame.PlayerHealth;
+    Snapshot.MaterialInventory = SaveGame.MaterialInventory;
+    Snapshot.WeaponInventory = SaveGame.WeaponInventory;
+    Snapshot.EquippedWeaponName = SaveGame.EquippedWeaponName;
+    Snapshot.QuickSlots = SaveGame.QuickSlots;
+    Snapshot.EquippedArmorMap = SaveGame.EquippedArmorMap;
+    Snapshot.BaseDefense = SaveGame.BaseDefense;
+    Snapshot.BaseAttack = SaveGame.BaseAttack;
+
+    for (const TPair<FName, bool>& Bridge : SaveGame.BuiltBridges)
+    {
+        if (Bridge.Value)
+        {
+            Snapshot.BuiltBridges.Add(Bridge.Key);
+        }
+    }
+    return Snapshot;
+}
+
+void FPlayerSaveSnapshot::WriteCompact(FArchive& Ar) const
+{
+    FNameTable Table;
+    for (const TPair<FName, int32>& Stack : MaterialInventory)
+    {
+        Table.Add(Stack.Key);
+    }
+    for (FName Name : WeaponInventory)
+    {
+        Table.Add(Name);
+    }
+    Table.Add(EquippedWeaponName);
+    for (FName Name : QuickSlots)
+    {
+        Table.Add(Name);
+    }
+    for (const TPair<uint8, FName>& Armor : EquippedArmorMap)
+    {
+        Table.Add(Armor.Value);
+    }
+    for (FName Bridge : BuiltBridges)
+    {
+        Table.Add(Bridge);
+    }
+    for (const TPair<FName, FIslandWorldState>& Island : Islands)
+    {
+        Table.Add(Island.Key);
+        for (const FPlacedObject& Placed : Island.Value.PlacedObjects)
+        {
+            Table.Add(Placed.ItemName);
+        }
+    }
+
+    uint32 NumNames = Table.Names.Num();
+    Ar.SerializeIntPacked(NumNames);
+    for (FName Name : Table.Names)
+    {
+        FString String = Name.ToString();
+        Ar << String;
+    }
+
+    FVector Location = PlayerLocation;
+    FRotator Rotation = PlayerRotation;
+    FString LevelName = CurrentLevelName;
+    int32 Health = PlayerHealth;
+    Ar << Location << Rotation << LevelName;
+    SerializeSignedPacked(Ar, Health);
+
+    uint32 Count = MaterialInventory.Num();
+    Ar.SerializeIntPacked(Count);
+    for (const TPair<FName, int32>& Stack : MaterialInventory)
+    {
+        uint32 Index = Table.Get(Stack.Key);
+        int32 Amount = Stack.Value;
+        Ar.SerializeIntPacked(Index);
+        SerializeSignedPacked(Ar, Amount);
+    }
+
+    Count = WeaponInventory.Num();
+    Ar.SerializeIntPacked(Count);
+    for (FName Name : WeaponInventory)
+    {
+        uint32 Index = Table.Get(Name);
+        Ar.SerializeIntPacked(Index);
+    }
+
+    uint32 EquippedIndex = Table.Get(EquippedWeaponName);
+    Ar.SerializeIntPacked(EquippedIndex);
+
+    Count = QuickSlots.Num();
+    Ar.SerializeIntPacked(Count);
+    for (FName Name : QuickSlots)
+    {
+        uint32 Index = Table.Get(Name);
+        Ar.SerializeIntPacked(Index);
+    }
+
+    Count = EquippedArmorMap.Num();
+    Ar.SerializeIntPacked(Count);
+    for (const TPair<uint8, FName>& Armor : EquippedArmorMap)
+    {
+        uint8 Slot = Armor.Key;
+        uint32 Index = Table.Get(Armor.Value);
+        Ar << Slot;
+        Ar.SerializeIntPacked(Index);
+    }
+
+    // One bit per name table entry
+    TArray<uint8> BridgeBits;
+    BridgeBits.SetNumZeroed((Table.Names.Num() + 7) / 8);
+    for (FName Bridge : BuiltBridges)
+    {
+        const uint32 Index = Table.Get(Bridge);
+        BridgeBits[Index / 8] |= (uint8)(1u << (Index % 8));
+    }
+    Ar.Serialize(BridgeBits.GetData(), BridgeBits.Num());
+
+    float Defense = BaseDefense;
+    float Attack = BaseAttack;
+    Ar << Defense << Attack;
+
+    Count = Islands.Num();
+    Ar.SerializeIntPacked(Count);
+    for (const TPair<FName, FIslandWorldState>& Island : Islands)
+    {
+        const FIslandWorldState& State = Island.Value;
+        uint32 NameIndex = Table.Get(Island.Key);
+        int32 Seed = State.Seed;
+        Ar.SerializeIntPacked(NameIndex);
+        Ar << Seed;
+
+        // Most chunks are empty; write the others as (gap since the previous one, bits)
+        uint32 NumChunks = 0;
+        for (uint64 Bits : State.HarvestedChunks)
+        {
+            NumChunks += Bits != 0 ? 1 : 0;
+        }
+        Ar.SerializeIntPacked(NumChunks);
+
+        int32 PreviousChunk = -1;
+        for (int32 ChunkIndex = 0; ChunkIndex < State.HarvestedChunks.Num(); ++ChunkIndex)
+        {
+            uint64 Bits = State.HarvestedChunks[ChunkIndex];
+            if (Bits == 0)
+                continue;
+
+            uint32 Gap = ChunkIndex - PreviousChunk - 1;
+            Ar.SerializeIntPacked(Gap);
+            Ar << Bits;
+            PreviousChunk = ChunkIndex;
+        }
+
+        Count = State.PlacedObjects.Num();
+        Ar.SerializeIntPacked(Count);
+        for (const FPlacedObject& Placed : State.PlacedObjects)
+        {
+            uint32 Index = Table.Get(Placed.ItemName);
+            FVector PlacedLocation = Placed.Location;
+            float Yaw = Placed.Yaw;
+            Ar.SerializeIntPacked(Index);
+            Ar << PlacedLocation << Yaw;
+        }
+
+        Count = State.Enemies.Num();
+        Ar.SerializeIntPacked(Count);
+        for (const FSavedEnemy& Enemy : State.Enemies)
+        {
+            uint8 Archetype = Enemy.Archetype;
+            FVector EnemyLocation = Enemy.Location;
+            int32 EnemyHealth = Enemy.Health;
+            Ar << Archetype << EnemyLocation;
+            SerializeSignedPacked(Ar, EnemyHealth);
+        }
+    }
+
+    float PlayTime = PlayTimeSeconds;
+    Ar << PlayTime;
+}
+
+void FPlayerSaveSnapshot::ReadCompact(FArchive& Ar)
+{
+    const uint32 NumNames = ReadCount(Ar);
+    TArray<FName> Names;
+    Names.Reserve(NumNames);
+    for (uint32 i = 0; i < NumNames && !Ar.IsError(); ++i)
+    {
+        FString String;
+        Ar << String;
+        Names.Add(FName(*String));
+    }
+
+    Ar << PlayerLocation << PlayerRotation << CurrentLevelName;
+    SerializeSignedPacked(Ar, PlayerHealth);
+
+    uint32 Count = ReadCount(Ar);
+    MaterialInventory.Reserve(Count);
+    for (uint32 i = 0; i < Count && !Ar.IsError(); ++i)
+    {
+        const FName Name = ReadName(Ar, Names);
+        int32 Amount = 0;
+        SerializeSignedPacked(Ar, Amount);
+        MaterialInventory.Add(Name, Amount);
+    }
+
+    Count = ReadCount(Ar);
+    WeaponInventory.Reserve(Count);
+    for (uint32 i = 0; i < Count && !Ar.IsError(); ++i)
+    {
+        WeaponInventory.Add(ReadName(Ar, Names));
+    }
+
+    EquippedWeaponName = ReadName(Ar, Names);
+
+    Count = ReadCount(Ar);
+    QuickSlots.Reserve(Count);
+    for (uint32 i = 0; i < Count && !Ar.IsError(); ++i)
+    {
+        QuickSlots.Add(ReadName(Ar, Names));
+    }
+
+    Count = ReadCount(Ar);
+    for (uint32 i = 0; i < Count && !Ar.IsError(); ++i)
+    {
+        uint8 Slot = 0;
+        Ar << Slot;
+        EquippedArmorMap.Add(Slot, ReadName(Ar, Names));
+    }
+
+    TArray<uint8> BridgeBits;
+    BridgeBits.SetNumZeroed((Names.Num() + 7) / 8);
+    Ar.Serialize(BridgeBits.GetData(), BridgeBits.Num());
+    for (int32 Index = 0; Index < Names.Num(); ++Index)
+    {
+        if (BridgeBits[Index / 8] & (1u << (Index % 8)))
+        {
+            BuiltBridges.Add(Names[Index]);
+        }
+    }
+
+    Ar << BaseDefense << BaseAttack;
+
+    Count = ReadCount(Ar);
+    for (uint32 i = 0; i < Count && !Ar.IsError(); ++i)
+    {
+        const FName IslandName = ReadName(Ar, Names);
+        FIslandWorldState& State = Islands.Add(IslandName);
+        Ar << State.Seed;
+
+        const uint32 NumChunks = ReadCount(Ar);
+        int32 ChunkIndex = -1;
+        for (uint32 j = 0; j < NumChunks && !Ar.IsError(); ++j)
+        {
+            uint32 Gap = 0;
+            uint64 Bits = 0;
+            Ar.SerializeIntPacked(Gap);
+            Ar << Bits;
+
+            if (Gap >= (uint32)(FIslandWorldState::MaxChunks - ChunkIndex - 1))
+            {
+                Ar.SetError();
+                break;
+            }
+            ChunkIndex += Gap + 1;
+            State.SetChunk(ChunkIndex, Bits);
+        }
+
+        const uint32 NumPlaced = ReadCount(Ar);
+        State.PlacedObjects.Reserve(NumPlaced);
+        for (uint32 j = 0; j < NumPlaced && !Ar.IsError(); ++j)
+        {
+            FPlacedObject& Placed = State.PlacedObjects.AddDefaulted_GetRef();
+            Placed.ItemName = ReadName(Ar, Names);
+            Ar << Placed.Location << Placed.Yaw;
+        }
+
+        const uint32 NumEnemies = ReadCount(Ar);
+        State.Enemies.Reserve(NumEnemies);
+        for (uint32 j = 0; j < NumEnemies && !Ar.IsError(); ++j)
+        {
+            FSavedEnemy& Enemy = State.Enemies.AddDefaulted_GetRef();
+            Ar << Enemy.Archetype << Enemy.Location;
+            SerializeSignedPacked(Ar, Enemy.Health);
+        }
+    }
+
+    Ar << PlayTimeSeconds;
+}
+
+bool FPlayerSaveSnapshot::WriteToBytes(const FPlayerSaveSnapshot& Snapshot, TArray<uint8>& OutBytes)
+{
+    TArray<uint8> Payload;
+    FMemoryWriter PayloadWriter(Payload, /*bIsPersistent*/ true);
+    Snapshot.WriteCompact(PayloadWriter);
+
+    const int32 Setting = CVarSaveCompression.GetValueOnAnyThread();
+    uint8 Compression = (uint8)FMath::Clamp(Setting, 0, (int32)ESaveCompression::Count - 1);
+
+    TArray<uint8> Compressed;
+    if (!Compress((ESaveCompression)Compression, Payload, Compressed))
+        return false;
+
+    OutBytes.Reset();
+    FMemoryWriter Ar(OutBytes, /*bIsPersistent*/ true);
+
+    uint32 Magic = SnapshotMagic;
+    int32 Version = SnapshotVersion;
+    int32 PayloadSize = Payload.Num();
+    uint32 Checksum = FCrc::MemCrc32(Payload.GetData(), Payload.Num());
+    Ar << Magic << Version << Compression << PayloadSize << Checksum;
+    Ar.Serialize(Compressed.GetData(), Compressed.Num());
+
+    return !Ar.IsError();
+}
+
+TSharedPtr<FPlayerSaveSnapshot> FPlayerSaveSnapshot::ReadFromBytes(const TArray<uint8>& Bytes)
+{
+    FMemoryReader Ar(Bytes, /*bIsPersistent*/ true);
+
+    uint32 Magic = 0;
+    int32 Version = 0;
+    Ar << Magic << Version;
+    if (Ar.IsError() || Magic != SnapshotMagic || Version != SnapshotVersion)
+        return nullptr;
+
+    uint8 Compression = 0;
+    int32 PayloadSize = 0;
+    uint32 Checksum = 0;
+    Ar << Compression << PayloadSize << Checksum;
+
+    if (Ar.IsError() || Compression >= (uint8)ESaveCompression::Count || PayloadSize < 0 || PayloadSize > MaxPayloadSize)
+        return nullptr;
+
+    TArray<uint8> Payload;
+    Payload.SetNumUninitialized(PayloadSize);
+
+    const int32 HeaderSize = (int32)Ar.Tell();
+    if (!Decompress((ESaveCompression)Compression, Bytes.GetData() + HeaderSize, Bytes.Num() - HeaderSize, Payload))
+        return nullptr;
+
+    if (FCrc::MemCrc32(Payload.GetData(), Payload.Num()) != Checksum)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Save file checksum mismatch"));
+        return nullptr;
+    }
+
+    TSharedPtr<FPlayerSaveSnapshot> Snapshot = MakeShared<FPlayerSaveSnapshot>();
+    FMemoryReader PayloadReader(Payload, /*bIsPersistent*/ true);
+
+    Snapshot->ReadCompact(PayloadReader);
+
+    return PayloadReader.IsError() ? nullptr : Snapshot;
+}
+
+#if !UE_BUILD_SHIPPING
+
+namespace
+{
+    // SaveGame.Benchmark [NumMaterials] [Iterations]: legacy USaveGame tagged serialization vs the snapshot format
+    void RunSaveBenchmark(const TArray<FString>& Args)
+    {
+        const int32 NumMaterials = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 5000;
+        const int32 Iterations = Args.Num() > 1 ? FMath::Max(1, FCString::Atoi(*Args[1])) : 20;
+
+        FPlayerSaveSnapshot Snapshot;
+        Snapshot.CurrentLevelName = TEXT("Island_01");
+        for (int32 i = 0; i < NumMaterials; ++i)
+        {
+            Snapshot.MaterialInventory.Add(FName(*FString::Printf(TEXT("Material_%d"), i)), 1 + i % 99);
+        }
+        for (int32 i = 0; i < NumMaterials / 10; ++i)
+        {
+            Snapshot.WeaponInventory.Add(FName(*FString::Printf(TEXT("Weapon_%d"), i % 32)));
+        }
+        for (int32 i = 0; i < 8; ++i)
+        {
+            Snapshot.QuickSlots.Add(FName(*FString::Printf(TEXT("Material_%d"), i)));
+        }
+        for (uint8 Slot = 0; Slot < 4; ++Slot)
+        {
+            Snapshot.EquippedArmorMap.Add(Slot, FName(*FString::Printf(TEXT("Armor_%d"), Slot)));
+        }
+        for (int32 i = 0; i < 64; ++i)
+        {
+            Snapshot.BuiltBridges.Add(FName(*FString::Printf(TEXT("Bridge_%d"), i)));
+        }
+
+        UBridgeAndBladeSaveGame* Legacy = NewObject<UBridgeAndBladeSaveGame>();
+        Legacy->CurrentLevelName = Snapshot.CurrentLevelName;
+        Legacy->MaterialInventory = Snapshot.MaterialInventory;
+        Legacy->WeaponInventory = Snapshot.WeaponInventory;
+        Legacy->QuickSlots = Snapshot.QuickSlots;
+        Legacy->EquippedArmorMap = Snapshot.EquippedArmorMap;
+        for (FName Bridge : Snapshot.BuiltBridges)
+        {
+            Legacy->BuiltBridges.Add(Bridge, true);
+        }
+
+        TArray<uint8> Bytes;
+        double Start = FPlatformTime::Seconds();
+        for (int32 i = 0; i < Iterations; ++i)
+        {
+            UGameplayStatics::SaveGameToMemory(Legacy, Bytes);
+        }
+        const double LegacySave = (FPlatformTime::Seconds() - Start) * 1000.0 / Iterations;
+
+        Start = FPlatformTime::Seconds();
+        for (int32 i = 0; i < Iterations; ++i)
+        {
+            UGameplayStatics::LoadGameFromMemory(Bytes);
+        }
+        const double LegacyLoad = (FPlatformTime::Seconds() - Start) * 1000.0 / Iterations;
+
+        UE_LOG(LogTemp, Display, TEXT("SaveBenchmark: %d materials, %d iterations"), NumMaterials, Iterations);
+        UE_LOG(LogTemp, Display, TEXT("  USaveGame      %8d bytes  save %7.3f ms  load %7.3f ms"), Bytes.Num(), LegacySave, LegacyLoad);
+
+        const int32 Saved = CVarSaveCompression.GetValueOnGameThread();
+        static const TCHAR* CompressionNames[] = { TEXT("none"), TEXT("zlib"), TEXT("LZ4"), TEXT("Oodle") };
+
+        for (int32 Compression = 0; Compression < (int32)ESaveCompression::Count; ++Compression)
+        {
+            CVarSaveCompression->Set(Compression, ECVF_SetByCode);
+
+            Start = FPlatformTime::Seconds();
+            for (int32 i = 0; i < Iterations; ++i)
+            {
+                FPlayerSaveSnapshot::WriteToBytes(Snapshot, Bytes);
+            }
+            const double Save = (FPlatformTime::Seconds() - Start) * 1000.0 / Iterations;
+
+            bool bRoundTrip = true;
+            Start = FPlatformTime::Seconds();
+            for (int32 i = 0; i < Iterations; ++i)
+            {
+                bRoundTrip &= FPlayerSaveSnapshot::ReadFromBytes(Bytes).IsValid();
+            }
+            const double Load = (FPlatformTime::Seconds() - Start) * 1000.0 / Iterations;
+
+            UE_LOG(LogTemp, Display, TEXT("  Snapshot %-5s %8d bytes  save %7.3f ms  load %7.3f ms%s"),
+                CompressionNames[Compression], Bytes.Num(), Save, Load, bRoundTrip ? TEXT("") : TEXT("  (READ FAILED)"));
+        }
+
+        CVarSaveCompression->Set(Saved, ECVF_SetByCode);
+    }
+
+    FAutoConsoleCommand SaveBenchmarkCommand(
+        TEXT("SaveGame.Benchmark"),
+        TEXT("Compare size and save / load time of the legacy USaveGame and the snapshot format. Args: [NumMaterials=5000] [Iterations=20]"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&RunSaveBenchmark));
+}
+
+#endif
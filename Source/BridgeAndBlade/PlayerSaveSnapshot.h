@@ -0,0 +1,53 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "IslandWorldState.h"
+
+class UBridgeAndBladeSaveGame;
+
+/**
+ * Everything a save slot holds, as plain data. Captured on the game thread by USaveGameManager
+ * and never modified afterwards, so the serialize / compress / write steps can run on a worker
+ * while gameplay keeps going. Items are kept by name; ids are per-session.
+ */
+struct BRIDGEANDBLADE_API FPlayerSaveSnapshot
+{
+    FVector PlayerLocation = FVector::ZeroVector;
+    FRotator PlayerRotation = FRotator::ZeroRotator;
+    FString CurrentLevelName;
+    int32 PlayerHealth = 100;
+
+    TMap<FName, int32> MaterialInventory;
+    TArray<FName> WeaponInventory;
+    FName EquippedWeaponName;
+    TArray<FName> QuickSlots;
+
+    // Keyed by EArmorSlot
+    TMap<uint8, FName> EquippedArmorMap;
+
+    TArray<FName> BuiltBridges;
+
+    // Keyed by level name
+    TMap<FName, FIslandWorldState> Islands;
+
+    float BaseDefense = 0.0f;
+    float BaseAttack = 1.0f;
+
+    float PlayTimeSeconds = 0.0f;
+
+    // Saves written before the snapshot format (UGameplayStatics slots)
+    static FPlayerSaveSnapshot FromLegacy(const UBridgeAndBladeSaveGame& SaveGame);
+
+    // File image in the current version: header (version, compression, CRC) + compressed compact payload
+    static bool WriteToBytes(const FPlayerSaveSnapshot& Snapshot, TArray<uint8>& OutBytes);
+
+    // nullptr if unreadable, corrupt or of an unknown version
+    static TSharedPtr<FPlayerSaveSnapshot> ReadFromBytes(const TArray<uint8>& Bytes);
+
+private:
+    // Payload: name table, then indices and packed ints
+    void WriteCompact(FArchive& Ar) const;
+    void ReadCompact(FArchive& Ar);
+};
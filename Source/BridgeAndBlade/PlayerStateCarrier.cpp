@@ -0,0 +1,35 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "PlayerStateCarrier.h"
+#include "Engine/GameInstance.h"
+#include "Kismet/GameplayStatics.h"
+
+UPlayerStateCarrier* UPlayerStateCarrier::Get(const UObject* WorldContextObject)
+{
+    UGameInstance* GameInstance = UGameplayStatics::GetGameInstance(WorldContextObject);
+    return GameInstance ? GameInstance->GetSubsystem<UPlayerStateCarrier>() : nullptr;
+}
+
+void UPlayerStateCarrier::Store(TSharedPtr<const FPlayerSaveSnapshot>&& InState, FName InDestinationLevel)
+{
+    State = MoveTemp(InState);
+    DestinationLevel = InDestinationLevel;
+}
+
+TSharedPtr<const FPlayerSaveSnapshot> UPlayerStateCarrier::Take(FName LevelName)
+{
+    if (!State.IsValid())
+        return nullptr;
+
+    TSharedPtr<const FPlayerSaveSnapshot> Taken = MoveTemp(State);
+    State.Reset();
+
+    if (LevelName != DestinationLevel)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("PlayerStateCarrier: state was carried to %s but arrived in %s, using the save instead"),
+            *DestinationLevel.ToString(), *LevelName.ToString());
+        return nullptr;
+    }
+
+    return Taken;
+}
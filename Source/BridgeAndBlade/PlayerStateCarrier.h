@@ -0,0 +1,39 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "PlayerSaveSnapshot.h"
+#include "PlayerStateCarrier.generated.h"
+
+/**
+ * The player's state on its way from one level to the next. A bridge stores what the player
+ * carries just before OpenLevel and the next level's player takes it back once it has spawned,
+ * so level travel never waits on a save file. Writing the slot is a separate background save
+ * that may still be running while the next level loads.
+ *
+ * The state is moved in and moved out, never copied; the save written alongside shares the same
+ * immutable snapshot. Only the level it was stored for can take it, so a travel that ends up
+ * somewhere else (a failed OpenLevel, a load from the menu) falls back to the save slot.
+ */
+UCLASS()
+class BRIDGEANDBLADE_API UPlayerStateCarrier : public UGameInstanceSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    static UPlayerStateCarrier* Get(const UObject* WorldContextObject);
+
+    // Hold State until DestinationLevel's player takes it; replaces anything still held
+    void Store(TSharedPtr<const FPlayerSaveSnapshot>&& State, FName DestinationLevel);
+
+    // Hand the held state over if it was stored for LevelName; dropped either way
+    TSharedPtr<const FPlayerSaveSnapshot> Take(FName LevelName);
+
+    bool IsCarrying() const { return State.IsValid(); }
+
+private:
+    TSharedPtr<const FPlayerSaveSnapshot> State;
+    FName DestinationLevel;
+};
@@ -79,12 +79,14 @@ void UPlayerUIWidget::SetQuickSlot(int SlotIndex, const FItemData& ItemData)
 		NameWidget->SetText(ItemData.DisplayName);
 	}
 
+	UItemDatabase* DB = UItemDatabase::Get(this);
+	UTexture2D* Icon = DB ? DB->GetItemIcon(ItemData) : ItemData.Icon.LoadSynchronous();
 	if (IconWidget)
 	{
-		SetSlotIcon(IconWidget, ItemData.Icon);
+		SetSlotIcon(IconWidget, Icon);
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("SetQuickSlot: slot=%d item=%s icon=%p"), SlotIndex + 1, *ItemData.ItemName.ToString(), (void*)ItemData.Icon);
+	UE_LOG(LogTemp, Log, TEXT("SetQuickSlot: slot=%d item=%s icon=%p"), SlotIndex + 1, *ItemData.ItemName.ToString(), (void*)Icon);
 }
 
 void UPlayerUIWidget::SetSlotIcon(UImage* IconWidget, UTexture2D* Icon)
@@ -1,29 +1,461 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
 
-#include "SaveGameManager.h"
-
 #include "SaveGameManager.h"
 #include "PaperChar.h"
+#include "InventoryComponent.h"
+#include "ItemDatabase.h"
 #include "BridgeZone.h"
+#include "IslandGameMode.h"
+#include "IslandStreamingSubsystem.h"
+#include "PlayerStateCarrier.h"
+#include "BridgeAndBladeSaveGame.h"
+#include "Async/Async.h"
+#include "Tasks/Task.h"
+#include "Engine/GameInstance.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "TimerManager.h"
 #include "Kismet/GameplayStatics.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace
+{
+    TAutoConsoleVariable<bool> CVarSaveJournal(
+        TEXT("SaveGame.Journal"),
+        true,
+        TEXT("Append inventory changes, bridge builds and checkpoints to a per-slot journal instead of rewriting the save"));
+
+    TAutoConsoleVariable<int32> CVarJournalCompactThreshold(
+        TEXT("SaveGame.JournalCompactThreshold"),
+        256,
+        TEXT("Journal records after which the journal is folded into the base save"));
+
+    TAutoConsoleVariable<float> CVarCheckpointInterval(
+        TEXT("SaveGame.CheckpointInterval"),
+        30.0f,
+        TEXT("Seconds between journaled checkpoints of position and health (0 = only on equipment changes)"));
+
+    TAutoConsoleVariable<float> CVarAutosaveInterval(
+        TEXT("SaveGame.AutosaveInterval"),
+        300.0f,
+        TEXT("Seconds between timed autosaves (skipped when nothing changed); 0 disables them"));
+
+    TAutoConsoleVariable<float> CVarAutosaveMinInterval(
+        TEXT("SaveGame.AutosaveMinInterval"),
+        30.0f,
+        TEXT("Minimum seconds between two autosaves, whatever triggered them"));
+
+    TAutoConsoleVariable<bool> CVarAutosaveOnEvents(
+        TEXT("SaveGame.AutosaveOnEvents"),
+        true,
+        TEXT("Autosave after crafting, building a bridge or equipping"));
+
+    const TCHAR* AutosaveSlots[] = { TEXT("AutosaveA"), TEXT("AutosaveB") };
+
+    constexpr uint32 SlotIndexMagic = 0x49534242; // "BBSI"
+    constexpr int32 SlotIndexVersion = 1;
+
+    void SerializeSlotInfo(FArchive& Ar, FSaveSlotInfo& Info)
+    {
+        Ar << Info.SlotName << Info.Timestamp << Info.LevelName << Info.PlayerHealth;
+        Ar << Info.PlayTimeSeconds << Info.BridgesBuilt << Info.ThumbnailPath;
+    }
+
+    // Write next to the target and rename over it, so a crash mid-write never leaves a torn slot
+    bool WriteFileAtomic(const FString& FilePath, const TArray<uint8>& Bytes)
+    {
+        const FString TempPath = FilePath + TEXT(".tmp");
+        if (!FFileHelper::SaveArrayToFile(Bytes, *TempPath))
+            return false;
+
+        if (!IFileManager::Get().Move(*FilePath, *TempPath, /*bReplace*/ true, /*bEvenIfReadOnly*/ true))
+        {
+            IFileManager::Get().Delete(*TempPath);
+            return false;
+        }
+        return true;
+    }
+
+    // Base snapshot with its journal applied, nullptr if neither exists
+    TSharedPtr<FPlayerSaveSnapshot> ReadBaseAndJournal(const FString& BasePath, const FString& JournalPath)
+    {
+        TSharedPtr<FPlayerSaveSnapshot> Snapshot;
+
+        TArray<uint8> Bytes;
+        if (FFileHelper::LoadFileToArray(Bytes, *BasePath, FILEREAD_Silent))
+        {
+            Snapshot = FPlayerSaveSnapshot::ReadFromBytes(Bytes);
+            if (!Snapshot)
+            {
+                UE_LOG(LogTemp, Warning, TEXT("Save file %s is unreadable"), *BasePath);
+                return nullptr;
+            }
+        }
+
+        if (IFileManager::Get().FileExists(*JournalPath))
+        {
+            // A journal without a base started from a fresh game
+            FPlayerSaveSnapshot Folded = Snapshot ? *Snapshot : FPlayerSaveSnapshot();
+            SaveJournal::Replay(JournalPath, Folded);
+            Snapshot = MakeShared<FPlayerSaveSnapshot>(MoveTemp(Folded));
+        }
+
+        return Snapshot;
+    }
+}
+
+void USaveGameManager::Initialize(FSubsystemCollectionBase& Collection)
+{
+    // Loading resolves item names to ids, so the database has to exist first
+    Collection.InitializeDependency<UItemDatabase>();
+    Super::Initialize(Collection);
+
+    CurrentSnapshot.Reset();
+    bHasUnsavedChanges = false;
+    PlayTimeStart = FPlatformTime::Seconds();
+
+    LoadSlotIndex();
+
+    // Start with the older autosave slot, never the newest
+    NextAutosaveSlot = GetLatestAutosaveSlot() == AutosaveSlots[0] ? 1 : 0;
+    LastAutosaveTime = FPlatformTime::Seconds();
+    ArmAutosaveTimer();
+
+    const float CheckpointInterval = CVarCheckpointInterval.GetValueOnGameThread();
+    if (CheckpointInterval > 0.0f)
+    {
+        GetGameInstance()->GetTimerManager().SetTimer(CheckpointHandle, this, &USaveGameManager::HandleCheckpointTimer, CheckpointInterval, true);
+    }
+
+    // Read the save while the first level is still loading
+    PreloadSlot(GetStartupSlot());
+}
+
+void USaveGameManager::Deinitialize()
+{
+    GetGameInstance()->GetTimerManager().ClearAllTimersForObject(this);
+
+    // Quitting must not drop a save that is still being written
+    FlushJournal();
+    SavePipe.WaitUntilEmpty();
+
+    Super::Deinitialize();
+}
+
+USaveGameManager* USaveGameManager::Get(const UObject* WorldContextObject)
+{
+    UGameInstance* GameInstance = UGameplayStatics::GetGameInstance(WorldContextObject);
+    return GameInstance ? GameInstance->GetSubsystem<USaveGameManager>() : nullptr;
+}
+
+FString USaveGameManager::GetSlotFilePath(const FString& SlotName)
+{
+    return FPaths::ProjectSavedDir() / TEXT("SaveGames") / SlotName + TEXT(".bbsave");
+}
+
+FString USaveGameManager::GetJournalFilePath(const FString& SlotName)
+{
+    return FPaths::ProjectSavedDir() / TEXT("SaveGames") / SlotName + TEXT(".bbjournal");
+}
+
+FString USaveGameManager::GetSlotIndexFilePath()
+{
+    return FPaths::ProjectSavedDir() / TEXT("SaveGames") / TEXT("SlotIndex.bbindex");
+}
+
+void USaveGameManager::LoadSlotIndex()
+{
+    SlotInfos.Reset();
+
+    TArray<uint8> Bytes;
+    if (FFileHelper::LoadFileToArray(Bytes, *GetSlotIndexFilePath(), FILEREAD_Silent))
+    {
+        FMemoryReader Ar(Bytes, /*bIsPersistent*/ true);
+
+        uint32 Magic = 0;
+        int32 Version = 0;
+        int32 Count = 0;
+        Ar << Magic << Version << Count;
+
+        if (!Ar.IsError() && Magic == SlotIndexMagic && Version == SlotIndexVersion && Count >= 0 && Count <= Bytes.Num())
+        {
+            for (int32 i = 0; i < Count && !Ar.IsError(); ++i)
+            {
+                FSaveSlotInfo Info;
+                SerializeSlotInfo(Ar, Info);
+                SlotInfos.Add(Info.SlotName, MoveTemp(Info));
+            }
+        }
+
+        if (!Ar.IsError())
+            return;
+
+        UE_LOG(LogTemp, Warning, TEXT("Save slot index is unreadable, rebuilding it"));
+        SlotInfos.Reset();
+    }
+
+    // No index yet (or a broken one): summarize the slot files once, behind any writes
+    TWeakObjectPtr<USaveGameManager> WeakThis(this);
+    SavePipe.Launch(TEXT("RebuildSlotIndex"), [WeakThis]()
+    {
+        const FString SaveDir = FPaths::GetPath(GetSlotFilePath(TEXT("Slot")));
+        TArray<FString> Files;
+        IFileManager::Get().FindFiles(Files, *(SaveDir / TEXT("*.bbsave")), /*Files*/ true, /*Directories*/ false);
+
+        TArray<TPair<FString, TSharedPtr<const FPlayerSaveSnapshot>>> Found;
+        for (const FString& File : Files)
+        {
+            const FString SlotName = FPaths::GetBaseFilename(File);
+            if (TSharedPtr<const FPlayerSaveSnapshot> Snapshot = ReadSnapshotFile(SlotName))
+            {
+                Found.Emplace(SlotName, Snapshot);
+            }
+        }
+
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, Found = MoveTemp(Found)]()
+        {
+            USaveGameManager* This = WeakThis.Get();
+            if (!This)
+                return;
+
+            for (const TPair<FString, TSharedPtr<const FPlayerSaveSnapshot>>& Slot : Found)
+            {
+                // Slots saved since startup already have a fresher entry; deleted ones have none
+                if (!This->SlotInfos.Contains(Slot.Key) && !This->SlotGenerations.Contains(Slot.Key))
+                {
+                    This->UpdateSlotInfo(Slot.Key, *Slot.Value);
+                    This->SlotInfos[Slot.Key].Timestamp = IFileManager::Get().GetTimeStamp(*GetSlotFilePath(Slot.Key));
+                }
+            }
+            This->WriteSlotIndex();
+        });
+    });
+}
+
+void USaveGameManager::UpdateSlotInfo(const FString& SlotName, const FPlayerSaveSnapshot& Snapshot)
+{
+    FSaveSlotInfo& Info = SlotInfos.FindOrAdd(SlotName);
+    Info.SlotName = SlotName;
+    Info.Timestamp = FDateTime::UtcNow();
+    Info.LevelName = Snapshot.CurrentLevelName;
+    Info.PlayerHealth = Snapshot.PlayerHealth;
+    Info.PlayTimeSeconds = Snapshot.PlayTimeSeconds;
+    Info.BridgesBuilt = Snapshot.BuiltBridges.Num();
+}
+
+void USaveGameManager::WriteSlotIndex()
+{
+    TArray<uint8> Bytes;
+    FMemoryWriter Ar(Bytes, /*bIsPersistent*/ true);
 
-USaveGameManager* USaveGameManager::Instance = nullptr;
+    uint32 Magic = SlotIndexMagic;
+    int32 Version = SlotIndexVersion;
+    int32 Count = SlotInfos.Num();
+    Ar << Magic << Version << Count;
+    for (TPair<FString, FSaveSlotInfo>& Slot : SlotInfos)
+    {
+        SerializeSlotInfo(Ar, Slot.Value);
+    }
 
-USaveGameManager* USaveGameManager::Get(UObject* WorldContextObject)
+    SavePipe.Launch(TEXT("WriteSlotIndex"), [Bytes = MoveTemp(Bytes)]()
+    {
+        if (!WriteFileAtomic(GetSlotIndexFilePath(), Bytes))
+        {
+            UE_LOG(LogTemp, Error, TEXT("Failed to write the save slot index"));
+        }
+    });
+}
+
+TArray<FSaveSlotInfo> USaveGameManager::GetSaveSlots() const
 {
-    if (!Instance)
+    TArray<FSaveSlotInfo> Slots;
+    SlotInfos.GenerateValueArray(Slots);
+    Slots.Sort([](const FSaveSlotInfo& A, const FSaveSlotInfo& B)
     {
-        Instance = NewObject<USaveGameManager>();
-        Instance->AddToRoot(); // Prevent garbage collection
-        Instance->CurrentSaveData = nullptr;
+        return A.Timestamp > B.Timestamp;
+    });
+    return Slots;
+}
+
+bool USaveGameManager::GetSaveSlotInfo(const FString& SlotName, FSaveSlotInfo& OutInfo) const
+{
+    const FSaveSlotInfo* Info = SlotInfos.Find(SlotName);
+    if (!Info)
+        return false;
 
-        UE_LOG(LogTemp, Log, TEXT("SaveGameManager singleton created"));
+    OutInfo = *Info;
+    return true;
+}
+
+void USaveGameManager::SetSlotThumbnail(const FString& SlotName, const FString& ThumbnailPath)
+{
+    FSaveSlotInfo* Info = SlotInfos.Find(SlotName);
+    if (Info && Info->ThumbnailPath != ThumbnailPath)
+    {
+        Info->ThumbnailPath = ThumbnailPath;
+        WriteSlotIndex();
     }
-    return Instance;
+}
+
+void USaveGameManager::RequestAutosave(EAutosaveTrigger Trigger)
+{
+    if (bApplyingSnapshot || (Trigger != EAutosaveTrigger::Timer && !CVarAutosaveOnEvents.GetValueOnGameThread()))
+        return;
+
+    if (bAutosaveScheduled)
+    {
+        ++AutosaveStats.Coalesced;
+        return;
+    }
+
+    // Next tick at the earliest, so a burst of events in one frame is one save
+    FTimerManager& TimerManager = GetGameInstance()->GetTimerManager();
+    const double Wait = CVarAutosaveMinInterval.GetValueOnGameThread() - (FPlatformTime::Seconds() - LastAutosaveTime);
+
+    bAutosaveScheduled = true;
+    if (Wait > 0.0)
+    {
+        TimerManager.SetTimer(AutosaveHandle, this, &USaveGameManager::RunAutosave, (float)Wait, false);
+    }
+    else
+    {
+        AutosaveHandle = TimerManager.SetTimerForNextTick(this, &USaveGameManager::RunAutosave);
+    }
+}
+
+void USaveGameManager::ArmAutosaveTimer()
+{
+    const float Interval = CVarAutosaveInterval.GetValueOnGameThread();
+    if (Interval > 0.0f)
+    {
+        GetGameInstance()->GetTimerManager().SetTimer(AutosaveIntervalHandle, this, &USaveGameManager::HandleAutosaveTimer, Interval, false);
+    }
+}
+
+void USaveGameManager::HandleAutosaveTimer()
+{
+    if (bHasUnsavedChanges)
+    {
+        RequestAutosave(EAutosaveTrigger::Timer);
+    }
+    else
+    {
+        ArmAutosaveTimer();
+    }
+}
+
+void USaveGameManager::RunAutosave()
+{
+    bAutosaveScheduled = false;
+
+    // One autosave at a time; a slow disk pushes the next one back instead of queueing writes
+    if (bAutosaveInFlight)
+    {
+        bAutosaveScheduled = true;
+        GetGameInstance()->GetTimerManager().SetTimer(AutosaveHandle, this, &USaveGameManager::RunAutosave, 1.0f, false);
+        return;
+    }
+
+    UWorld* World = GetGameInstance()->GetWorld();
+    APaperChar* PlayerCharacter = World ? Cast<APaperChar>(UGameplayStatics::GetPlayerCharacter(World, 0)) : nullptr;
+    if (!PlayerCharacter)
+    {
+        ArmAutosaveTimer();
+        return;
+    }
+
+    const FString SlotName = AutosaveSlots[NextAutosaveSlot];
+    const double StartTime = FPlatformTime::Seconds();
+
+    bAutosaveInFlight = true;
+    const bool bStarted = SaveGameAsync(PlayerCharacter, SlotName,
+        FOnSaveGameComplete::CreateWeakLambda(this, [this, StartTime](bool bSuccess)
+        {
+            FinishAutosave(bSuccess, StartTime);
+        }));
+
+    // SaveGameAsync returns once the snapshot is captured; the rest happens on the pipe
+    AutosaveStats.LastCaptureMs = (float)((FPlatformTime::Seconds() - StartTime) * 1000.0);
+    AutosaveStats.MaxCaptureMs = FMath::Max(AutosaveStats.MaxCaptureMs, AutosaveStats.LastCaptureMs);
+
+    LastAutosaveTime = StartTime;
+    if (!bStarted)
+    {
+        FinishAutosave(false, StartTime);
+    }
+}
+
+void USaveGameManager::FinishAutosave(bool bSuccess, double StartTime)
+{
+    bAutosaveInFlight = false;
+
+    AutosaveStats.LastTotalMs = (float)((FPlatformTime::Seconds() - StartTime) * 1000.0);
+    AutosaveStats.MaxTotalMs = FMath::Max(AutosaveStats.MaxTotalMs, AutosaveStats.LastTotalMs);
+
+    if (bSuccess)
+    {
+        // Only move on once this slot is good; a failed write is retried into the same slot
+        ++AutosaveStats.Saves;
+        NextAutosaveSlot ^= 1;
+    }
+    else
+    {
+        ++AutosaveStats.Failures;
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("Autosave %s: capture %.2f ms, total %.1f ms (%d saved, %d failed, %d coalesced)"),
+        bSuccess ? TEXT("done") : TEXT("failed"), AutosaveStats.LastCaptureMs, AutosaveStats.LastTotalMs,
+        AutosaveStats.Saves, AutosaveStats.Failures, AutosaveStats.Coalesced);
+
+    ArmAutosaveTimer();
+}
+
+FString USaveGameManager::GetLatestAutosaveSlot() const
+{
+    const FSaveSlotInfo* A = SlotInfos.Find(AutosaveSlots[0]);
+    const FSaveSlotInfo* B = SlotInfos.Find(AutosaveSlots[1]);
+    if (A && (!B || A->Timestamp >= B->Timestamp))
+        return A->SlotName;
+    return B ? B->SlotName : FString();
+}
+
+FString USaveGameManager::GetStartupSlot() const
+{
+    // Once this session has loaded or written the active slot, it holds the live game
+    if (bActiveSlotCurrent)
+        return ActiveSlot;
+
+    const FSaveSlotInfo* AutosaveInfo = SlotInfos.Find(GetLatestAutosaveSlot());
+    if (!AutosaveInfo)
+        return ActiveSlot;
+
+    // Journaled checkpoints don't always reach the index, so the files' own times count too
+    IFileManager& FileManager = IFileManager::Get();
+    FDateTime ActiveTime = FMath::Max(FileManager.GetTimeStamp(*GetSlotFilePath(ActiveSlot)), FileManager.GetTimeStamp(*GetJournalFilePath(ActiveSlot)));
+    if (const FSaveSlotInfo* ActiveInfo = SlotInfos.Find(ActiveSlot))
+    {
+        ActiveTime = FMath::Max(ActiveTime, ActiveInfo->Timestamp);
+    }
+
+    return AutosaveInfo->Timestamp > ActiveTime ? AutosaveInfo->SlotName : ActiveSlot;
+}
+
+float USaveGameManager::GetPlayTimeSeconds() const
+{
+    return LoadedPlayTime + (float)(FPlatformTime::Seconds() - PlayTimeStart);
 }
 
 bool USaveGameManager::SaveGame(APaperChar* PlayerCharacter, const FString& SlotName)
+{
+    return SaveGameAsync(PlayerCharacter, SlotName, FOnSaveGameComplete());
+}
+
+bool USaveGameManager::SaveGameAsync(APaperChar* PlayerCharacter, const FString& SlotName, FOnSaveGameComplete OnComplete)
 {
     if (!PlayerCharacter)
     {
@@ -31,76 +463,353 @@ bool USaveGameManager::SaveGame(APaperChar* PlayerCharacter, const FString& Slot
         return false;
     }
 
-    // Create save game object
-    UBridgeAndBladeSaveGame* SaveGameInstance = Cast<UBridgeAndBladeSaveGame>(
-        UGameplayStatics::CreateSaveGameObject(UBridgeAndBladeSaveGame::StaticClass())
-    );
+    CaptureIslandEnemies(PlayerCharacter->GetWorld());
+    WriteSnapshot(SlotName, CaptureSnapshot(PlayerCharacter), MoveTemp(OnComplete));
+    return true;
+}
 
-    if (!SaveGameInstance)
-    {
-        UE_LOG(LogTemp, Error, TEXT("Failed to create save game object"));
+bool USaveGameManager::CarryPlayerState(APaperChar* PlayerCharacter, FName DestinationLevel, const FString& SlotName)
+{
+    UPlayerStateCarrier* Carrier = UPlayerStateCarrier::Get(this);
+    if (!PlayerCharacter || !Carrier)
         return false;
+
+    CaptureIslandEnemies(PlayerCharacter->GetWorld());
+    TSharedRef<const FPlayerSaveSnapshot> Snapshot = CaptureSnapshot(PlayerCharacter);
+
+    // The write only shares the snapshot; the next level is hydrated from the carrier either way
+    WriteSnapshot(SlotName, Snapshot, FOnSaveGameComplete());
+    Carrier->Store(MoveTemp(Snapshot), DestinationLevel);
+
+    UE_LOG(LogTemp, Log, TEXT("Carrying player state to %s"), *DestinationLevel.ToString());
+    return true;
+}
+
+void USaveGameManager::WriteSnapshot(const FString& SlotName, const TSharedRef<const FPlayerSaveSnapshot>& Snapshot, FOnSaveGameComplete OnComplete)
+{
+    // Changes from here on belong to the next save
+    bHasUnsavedChanges = false;
+    KnownSnapshots.Add(SlotName, Snapshot);
+    ++PendingSaves;
+
+    // Journal records not written yet are part of the snapshot
+    if (SlotName == ActiveSlot)
+    {
+        PendingRecords.Reset();
+        DirtyIslands.Reset();
+        JournalRecordCount = 0;
+        bActiveSlotCurrent = true;
     }
 
-    // Save slot info
-    SaveGameInstance->SaveSlotName = SlotName;
-    SaveGameInstance->UserIndex = 0;
+    const FString FilePath = GetSlotFilePath(SlotName);
+    const FString JournalPath = GetJournalFilePath(SlotName);
+    const int32 Generation = GetSlotGeneration(SlotName);
+    TWeakObjectPtr<USaveGameManager> WeakThis(this);
+
+    SavePipe.Launch(TEXT("WriteSaveGame"), [WeakThis, Snapshot, SlotName, Generation, FilePath, JournalPath, OnComplete]()
+    {
+        TArray<uint8> Bytes;
+        const bool bSuccess = FPlayerSaveSnapshot::WriteToBytes(*Snapshot, Bytes) && WriteFileAtomic(FilePath, Bytes);
+
+        // The full snapshot supersedes the journal; later appends are queued behind this task
+        if (bSuccess)
+        {
+            IFileManager::Get().Delete(*JournalPath, /*RequireExists*/ false, /*EvenReadOnly*/ true, /*Quiet*/ true);
+        }
 
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, Snapshot, SlotName, Generation, bSuccess, OnComplete]()
+        {
+            if (USaveGameManager* This = WeakThis.Get())
+            {
+                This->FinishSave(SlotName, Generation, Snapshot, bSuccess, OnComplete);
+            }
+            else
+            {
+                OnComplete.ExecuteIfBound(bSuccess);
+            }
+        });
+    });
+}
+
+void USaveGameManager::FinishSave(const FString& SlotName, int32 Generation, const TSharedRef<const FPlayerSaveSnapshot>& Snapshot, bool bSuccess, const FOnSaveGameComplete& OnComplete)
+{
+    --PendingSaves;
+
+    // The slot was deleted after this write was queued; the delete queued behind it removes the file
+    if (Generation != GetSlotGeneration(SlotName))
+    {
+        OnComplete.ExecuteIfBound(bSuccess);
+        return;
+    }
+
+    if (bSuccess)
+    {
+        CurrentSnapshot = Snapshot;
+        UpdateSlotInfo(SlotName, *Snapshot);
+        WriteSlotIndex();
+        UE_LOG(LogTemp, Log, TEXT("Game saved successfully to slot: %s"), *SlotName);
+    }
+    else
+    {
+        // What was captured never reached the disk; unless a newer save replaced it, forget it
+        const TSharedRef<const FPlayerSaveSnapshot>* Known = KnownSnapshots.Find(SlotName);
+        if (Known && *Known == Snapshot)
+        {
+            KnownSnapshots.Remove(SlotName);
+        }
+
+        bHasUnsavedChanges = true;
+        UE_LOG(LogTemp, Error, TEXT("Failed to save game to slot: %s"), *SlotName);
+    }
+
+    OnComplete.ExecuteIfBound(bSuccess);
+}
+
+TSharedRef<const FPlayerSaveSnapshot> USaveGameManager::CaptureSnapshot(APaperChar* PlayerCharacter) const
+{
+    TSharedRef<FPlayerSaveSnapshot> Snapshot = MakeShared<FPlayerSaveSnapshot>();
+    CapturePlayerFields(PlayerCharacter, *Snapshot);
+
+    // Item ids are per-session; the save keeps names
+    PlayerCharacter->Inventory->ExportStacks(Snapshot->MaterialInventory);
+    PlayerCharacter->Inventory->ExportWeapons(Snapshot->WeaponInventory);
+
+    Snapshot->BuiltBridges = BuiltBridges.Array();
+    Snapshot->Islands = Islands;
+
+    return Snapshot;
+}
+
+void USaveGameManager::CapturePlayerFields(APaperChar* PlayerCharacter, FPlayerSaveSnapshot& OutSnapshot) const
+{
     // Save player location and rotation
-    SaveGameInstance->PlayerLocation = PlayerCharacter->GetActorLocation();
-    SaveGameInstance->PlayerRotation = PlayerCharacter->GetActorRotation();
+    OutSnapshot.PlayerLocation = PlayerCharacter->GetActorLocation();
+    OutSnapshot.PlayerRotation = PlayerCharacter->GetActorRotation();
 
     // Save current level name
     UWorld* World = PlayerCharacter->GetWorld();
     if (World)
     {
-        SaveGameInstance->CurrentLevelName = World->GetMapName();
+        OutSnapshot.CurrentLevelName = World->GetMapName();
         // Remove "UEDPIE_0_" prefix if in PIE mode
-        SaveGameInstance->CurrentLevelName.RemoveFromStart(World->StreamingLevelsPrefix);
+        OutSnapshot.CurrentLevelName.RemoveFromStart(World->StreamingLevelsPrefix);
+
+        // Streamed islands share the persistent world's map name
+        if (const UIslandStreamingSubsystem* Streaming = UIslandStreamingSubsystem::Get(World))
+        {
+            OutSnapshot.CurrentLevelName = Streaming->GetCurrentIsland().ToString();
+        }
     }
 
-    // Save health
-    SaveGameInstance->PlayerHealth = PlayerCharacter->health;
+    OutSnapshot.PlayerHealth = PlayerCharacter->Attributes->GetHealth();
+    OutSnapshot.EquippedWeaponName = PlayerCharacter->EquippedWeaponName;
+    OutSnapshot.QuickSlots = PlayerCharacter->QuickSlots;
 
-    // Save inventory
-    SaveGameInstance->MaterialInventory = PlayerCharacter->MaterialInventory;
-    SaveGameInstance->WeaponInventory = PlayerCharacter->WeaponInventory;
-    SaveGameInstance->EquippedWeaponName = PlayerCharacter->EquippedWeaponName;
+    // Equipped armor (enum stored as uint8)
+    for (const auto& ArmorPair : PlayerCharacter->EquippedArmor)
+    {
+        OutSnapshot.EquippedArmorMap.Add(static_cast<uint8>(ArmorPair.Key), ArmorPair.Value);
+    }
 
-    // Save quick slots
-    SaveGameInstance->QuickSlots = PlayerCharacter->QuickSlots;
+    OutSnapshot.BaseDefense = PlayerCharacter->BaseDefense;
+    OutSnapshot.BaseAttack = PlayerCharacter->BaseAttack;
+    OutSnapshot.PlayTimeSeconds = GetPlayTimeSeconds();
+}
 
-    // Save equipped armor (convert enum to uint8 for serialization)
-    SaveGameInstance->EquippedArmorMap.Empty();
-    for (const auto& ArmorPair : PlayerCharacter->EquippedArmor)
+bool USaveGameManager::SaveCheckpoint(APaperChar* PlayerCharacter)
+{
+    // Restoring a save equips too; the result is the save itself
+    if (!PlayerCharacter || bApplyingSnapshot)
+        return false;
+
+    if (!CVarSaveJournal.GetValueOnGameThread())
+        return SaveGame(PlayerCharacter, ActiveSlot);
+
+    FPlayerSaveSnapshot Fields;
+    CapturePlayerFields(PlayerCharacter, Fields);
+    AppendRecord(FSaveJournalRecord::MakeCheckpoint(Fields));
+    CaptureIslandEnemies(PlayerCharacter->GetWorld());
+
+    // Inventory and bridges were journaled as they changed, so this covers everything
+    bHasUnsavedChanges = false;
+    return true;
+}
+
+void USaveGameManager::HandleEquipmentChanged(APaperChar* PlayerCharacter)
+{
+    if (bApplyingSnapshot)
+        return;
+
+    // The inventory side of an equip is journaled as a delta; the equipment has to follow in the same flush
+    if (CVarSaveJournal.GetValueOnGameThread())
     {
-        SaveGameInstance->EquippedArmorMap.Add(static_cast<uint8>(ArmorPair.Key), ArmorPair.Value);
+        SaveCheckpoint(PlayerCharacter);
     }
+    RequestAutosave(EAutosaveTrigger::Equip);
+}
 
-    // Save stats
-    SaveGameInstance->BaseDefense = PlayerCharacter->BaseDefense;
-    SaveGameInstance->BaseAttack = PlayerCharacter->BaseAttack;
+void USaveGameManager::HandleCheckpointTimer()
+{
+    if (!CVarSaveJournal.GetValueOnGameThread())
+        return;
 
-    // Save bridge states (use current save data if available)
-    if (CurrentSaveData)
+    UWorld* World = GetGameInstance()->GetWorld();
+    if (APaperChar* PlayerCharacter = World ? Cast<APaperChar>(UGameplayStatics::GetPlayerCharacter(World, 0)) : nullptr)
     {
-        SaveGameInstance->BuiltBridges = CurrentSaveData->BuiltBridges;
+        SaveCheckpoint(PlayerCharacter);
     }
+}
+
+void USaveGameManager::AppendRecord(FSaveJournalRecord&& Record)
+{
+    if (!CVarSaveJournal.GetValueOnGameThread())
+        return;
 
-    // Perform the save
-    bool bSuccess = UGameplayStatics::SaveGameToSlot(SaveGameInstance, SlotName, 0);
+    PendingRecords.Add(MoveTemp(Record));
+    ScheduleJournalFlush();
+}
 
-    if (bSuccess)
+void USaveGameManager::MarkIslandDirty(FName IslandName, int32 ChunkIndex)
+{
+    bHasUnsavedChanges = true;
+    if (!CVarSaveJournal.GetValueOnGameThread())
+        return;
+
+    FIslandDirtyState& Dirty = DirtyIslands.FindOrAdd(IslandName);
+    if (ChunkIndex == INDEX_NONE)
     {
-        CurrentSaveData = SaveGameInstance;
-        UE_LOG(LogTemp, Log, TEXT("Game saved successfully to slot: %s"), *SlotName);
+        Dirty.bObjects = true;
     }
     else
     {
-        UE_LOG(LogTemp, Error, TEXT("Failed to save game to slot: %s"), *SlotName);
+        if (ChunkIndex >= Dirty.Chunks.Num())
+        {
+            Dirty.Chunks.Add(false, ChunkIndex + 1 - Dirty.Chunks.Num());
+        }
+        Dirty.Chunks[ChunkIndex] = true;
     }
+    ScheduleJournalFlush();
+}
 
-    return bSuccess;
+void USaveGameManager::ScheduleJournalFlush()
+{
+    // One append per frame, however many changes it had
+    if (!bJournalFlushScheduled)
+    {
+        bJournalFlushScheduled = true;
+        GetGameInstance()->GetTimerManager().SetTimerForNextTick(this, &USaveGameManager::FlushJournal);
+    }
+}
+
+void USaveGameManager::FlushJournal()
+{
+    bJournalFlushScheduled = false;
+
+    // Dirty island chunks become one record each, holding the chunk as it is now
+    for (const TPair<FName, FIslandDirtyState>& Dirty : DirtyIslands)
+    {
+        const FIslandWorldState* State = Islands.Find(Dirty.Key);
+        if (!State)
+            continue;
+
+        if (Dirty.Value.bObjects)
+        {
+            PendingRecords.Add(FSaveJournalRecord::MakeIslandObjects(Dirty.Key, *State));
+        }
+        for (TConstSetBitIterator<> It(Dirty.Value.Chunks); It; ++It)
+        {
+            PendingRecords.Add(FSaveJournalRecord::MakeIslandChunk(Dirty.Key, *State, It.GetIndex()));
+        }
+    }
+    DirtyIslands.Reset();
+
+    if (PendingRecords.Num() == 0)
+        return;
+
+    TArray<FSaveJournalRecord> Records = MoveTemp(PendingRecords);
+    PendingRecords.Reset();
+
+    // Keep the cached slot contents in step with what the journal will replay to
+    bool bSummaryChanged = false;
+    if (const TSharedRef<const FPlayerSaveSnapshot>* Known = KnownSnapshots.Find(ActiveSlot))
+    {
+        TSharedRef<FPlayerSaveSnapshot> Updated = MakeShared<FPlayerSaveSnapshot>(**Known);
+        for (const FSaveJournalRecord& Record : Records)
+        {
+            Record.ApplyTo(*Updated);
+            bSummaryChanged |= Record.Type == ESaveJournalRecordType::Checkpoint || Record.Type == ESaveJournalRecordType::Bridge;
+        }
+        KnownSnapshots.Add(ActiveSlot, Updated);
+
+        // Inventory changes don't show in the slot list; checkpoints and bridges do
+        if (bSummaryChanged)
+        {
+            UpdateSlotInfo(ActiveSlot, *Updated);
+        }
+    }
+
+    JournalRecordCount += Records.Num();
+    SavePipe.Launch(TEXT("AppendSaveJournal"), [JournalPath = GetJournalFilePath(ActiveSlot), Records = MoveTemp(Records)]()
+    {
+        if (!SaveJournal::Append(JournalPath, Records))
+        {
+            UE_LOG(LogTemp, Error, TEXT("Failed to append to save journal %s"), *JournalPath);
+        }
+    });
+
+    if (bSummaryChanged)
+    {
+        WriteSlotIndex();
+    }
+
+    if (JournalRecordCount >= CVarJournalCompactThreshold.GetValueOnGameThread())
+    {
+        QueueCompaction(ActiveSlot);
+    }
+}
+
+void USaveGameManager::AdoptLoadedSlot(const FString& SlotName, const TSharedRef<const FPlayerSaveSnapshot>& Snapshot)
+{
+    // Startup always reads the active slot, so a game loaded from anywhere else becomes its new base;
+    // the write also drops the active slot's journal, which described the game that was replaced
+    if (SlotName != ActiveSlot)
+    {
+        WriteSnapshot(ActiveSlot, Snapshot, FOnSaveGameComplete());
+        return;
+    }
+
+    // Journal from here on against a folded base
+    bActiveSlotCurrent = true;
+    if (IFileManager::Get().FileExists(*GetJournalFilePath(SlotName)))
+    {
+        QueueCompaction(SlotName);
+    }
+}
+
+void USaveGameManager::QueueCompaction(const FString& SlotName)
+{
+    if (SlotName == ActiveSlot)
+    {
+        JournalRecordCount = 0;
+    }
+
+    SavePipe.Launch(TEXT("CompactSaveJournal"), [FilePath = GetSlotFilePath(SlotName), JournalPath = GetJournalFilePath(SlotName)]()
+    {
+        TSharedPtr<FPlayerSaveSnapshot> Folded = ReadBaseAndJournal(FilePath, JournalPath);
+        if (!Folded)
+            return;
+
+        // Replay is idempotent, so a crash between the rename and the delete only costs a re-fold
+        TArray<uint8> Bytes;
+        if (FPlayerSaveSnapshot::WriteToBytes(*Folded, Bytes) && WriteFileAtomic(FilePath, Bytes))
+        {
+            IFileManager::Get().Delete(*JournalPath, /*RequireExists*/ false, /*EvenReadOnly*/ true, /*Quiet*/ true);
+        }
+        else
+        {
+            UE_LOG(LogTemp, Error, TEXT("Failed to compact save journal %s"), *JournalPath);
+        }
+    });
 }
 
 bool USaveGameManager::LoadGame(APaperChar* PlayerCharacter, const FString& SlotName)
@@ -111,109 +820,409 @@ bool USaveGameManager::LoadGame(APaperChar* PlayerCharacter, const FString& Slot
         return false;
     }
 
-    // Load save game
-    UBridgeAndBladeSaveGame* LoadedGame = Cast<UBridgeAndBladeSaveGame>(
-        UGameplayStatics::LoadGameFromSlot(SlotName, 0)
-    );
-
-    if (!LoadedGame)
+    TSharedPtr<const FPlayerSaveSnapshot> Snapshot = ReadSlot(SlotName);
+    if (!Snapshot)
     {
         UE_LOG(LogTemp, Warning, TEXT("No save game found in slot: %s"), *SlotName);
         return false;
     }
 
-    CurrentSaveData = LoadedGame;
+    KnownSnapshots.Add(SlotName, Snapshot.ToSharedRef());
+    SetLoadedSnapshot(Snapshot);
+    ApplySnapshot(PlayerCharacter, *Snapshot);
+
+    AdoptLoadedSlot(SlotName, Snapshot.ToSharedRef());
+
+    UE_LOG(LogTemp, Log, TEXT("Game loaded successfully from slot: %s"), *SlotName);
+    return true;
+}
+
+void USaveGameManager::SetLoadedSnapshot(const TSharedPtr<const FPlayerSaveSnapshot>& Snapshot)
+{
+    CurrentSnapshot = Snapshot;
+    bHasUnsavedChanges = false;
+    LoadedPlayTime = Snapshot->PlayTimeSeconds;
+    PlayTimeStart = FPlatformTime::Seconds();
+    BuiltBridges = TSet<FName>(Snapshot->BuiltBridges);
+    Islands = Snapshot->Islands;
+    DirtyIslands.Reset();
+}
+
+void USaveGameManager::PreloadSlot(const FString& SlotName)
+{
+    if (KnownSnapshots.Contains(SlotName) || LoadingSlots.Contains(SlotName))
+        return;
+
+    LoadingSlots.Add(SlotName);
+    const int32 Generation = GetSlotGeneration(SlotName);
+    TWeakObjectPtr<USaveGameManager> WeakThis(this);
+
+    UE::Tasks::Launch(TEXT("ReadSaveGame"), [WeakThis, SlotName, Generation]()
+    {
+        TSharedPtr<const FPlayerSaveSnapshot> Snapshot = ReadSnapshotFile(SlotName);
+
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, SlotName, Generation, Snapshot]()
+        {
+            if (USaveGameManager* This = WeakThis.Get())
+            {
+                This->FinishPreload(SlotName, Generation, Snapshot);
+            }
+        });
+    });
+}
+
+void USaveGameManager::FinishPreload(const FString& SlotName, int32 Generation, TSharedPtr<const FPlayerSaveSnapshot> Snapshot)
+{
+    LoadingSlots.Remove(SlotName);
+
+    // The slot was deleted while the read was in flight
+    if (Generation != GetSlotGeneration(SlotName))
+    {
+        Snapshot.Reset();
+    }
+    // Only slots from before the snapshot format take this (synchronous) path
+    else if (!Snapshot)
+    {
+        Snapshot = ReadLegacySlot(SlotName);
+    }
+
+    // A save issued while the read was in flight is newer than what was on disk
+    if (Snapshot && !KnownSnapshots.Contains(SlotName))
+    {
+        KnownSnapshots.Add(SlotName, Snapshot.ToSharedRef());
+    }
+
+    if (DeferredLoadTarget.IsValid() && DeferredLoadSlot == SlotName)
+    {
+        ScheduleDeferredLoad();
+    }
+}
+
+void USaveGameManager::LoadGameDeferred(APaperChar* PlayerCharacter, const FString& SlotName)
+{
+    if (!PlayerCharacter)
+        return;
+
+    DeferredLoadTarget = PlayerCharacter;
+    DeferredLoadSlot = SlotName;
+
+    // Arrived by bridge: nothing to read
+    const UPlayerStateCarrier* Carrier = UPlayerStateCarrier::Get(this);
+    if (Carrier && Carrier->IsCarrying())
+    {
+        ScheduleDeferredLoad();
+        return;
+    }
+
+    PreloadSlot(SlotName);
+    if (!LoadingSlots.Contains(SlotName))
+    {
+        ScheduleDeferredLoad();
+    }
+}
+
+void USaveGameManager::ScheduleDeferredLoad()
+{
+    APaperChar* PlayerCharacter = DeferredLoadTarget.Get();
+    if (bDeferredLoadScheduled || !PlayerCharacter)
+        return;
+
+    // Never inside BeginPlay: equipping spawns the weapon actor and refreshes the HUD
+    bDeferredLoadScheduled = true;
+    PlayerCharacter->GetWorldTimerManager().SetTimerForNextTick(this, &USaveGameManager::ApplyDeferredLoad);
+}
+
+void USaveGameManager::ApplyDeferredLoad()
+{
+    bDeferredLoadScheduled = false;
+
+    APaperChar* PlayerCharacter = DeferredLoadTarget.Get();
+    DeferredLoadTarget.Reset();
+    if (!PlayerCharacter)
+        return;
+
+    // Bridges, islands and play time never left this game instance; only the player is new
+    UPlayerStateCarrier* Carrier = UPlayerStateCarrier::Get(this);
+    const bool bWasCarrying = Carrier && Carrier->IsCarrying();
+    const FName LevelName(*UGameplayStatics::GetCurrentLevelName(PlayerCharacter, /*bRemovePrefixString*/ true));
+    if (TSharedPtr<const FPlayerSaveSnapshot> Carried = Carrier ? Carrier->Take(LevelName) : nullptr)
+    {
+        TGuardValue<bool> ApplyingGuard(bApplyingSnapshot, true);
+        ApplyPlayerState(PlayerCharacter, *Carried);
+        UE_LOG(LogTemp, Log, TEXT("Player state carried over to %s"), *LevelName.ToString());
+
+        OnSaveApplied.Broadcast();
+        return;
+    }
+
+    // The carry was meant for another level and LoadGameDeferred skipped the read; do it now
+    if (bWasCarrying && !KnownSnapshots.Contains(DeferredLoadSlot))
+    {
+        PreloadSlot(DeferredLoadSlot);
+        if (LoadingSlots.Contains(DeferredLoadSlot))
+        {
+            DeferredLoadTarget = PlayerCharacter;
+            return;
+        }
+    }
+
+    if (const TSharedRef<const FPlayerSaveSnapshot>* Known = KnownSnapshots.Find(DeferredLoadSlot))
+    {
+        // Copied out: adopting the slot may add to KnownSnapshots
+        const TSharedRef<const FPlayerSaveSnapshot> Snapshot = *Known;
+
+        // Applying records Loaded deltas only, so nothing is journaled back
+        SetLoadedSnapshot(Snapshot);
+        ApplySnapshot(PlayerCharacter, *Snapshot);
+        AdoptLoadedSlot(DeferredLoadSlot, Snapshot);
+        UE_LOG(LogTemp, Log, TEXT("Game loaded successfully from slot: %s"), *DeferredLoadSlot);
+    }
+
+    OnSaveApplied.Broadcast();
+}
+
+TSharedPtr<const FPlayerSaveSnapshot> USaveGameManager::ReadSlot(const FString& SlotName) const
+{
+    // Newer than the file while a write is in flight, and saves a read after travel
+    if (const TSharedRef<const FPlayerSaveSnapshot>* Known = KnownSnapshots.Find(SlotName))
+    {
+        return *Known;
+    }
+
+    if (TSharedPtr<const FPlayerSaveSnapshot> Snapshot = ReadSnapshotFile(SlotName))
+    {
+        return Snapshot;
+    }
+
+    return ReadLegacySlot(SlotName);
+}
+
+TSharedPtr<const FPlayerSaveSnapshot> USaveGameManager::ReadSnapshotFile(const FString& SlotName)
+{
+    return ReadBaseAndJournal(GetSlotFilePath(SlotName), GetJournalFilePath(SlotName));
+}
+
+TSharedPtr<const FPlayerSaveSnapshot> USaveGameManager::ReadLegacySlot(const FString& SlotName)
+{
+    // Saves made before the snapshot format; rewritten in the new format on the next save
+    if (!UGameplayStatics::DoesSaveGameExist(SlotName, 0))
+        return nullptr;
+
+    if (const UBridgeAndBladeSaveGame* LegacyGame = Cast<UBridgeAndBladeSaveGame>(UGameplayStatics::LoadGameFromSlot(SlotName, 0)))
+    {
+        return MakeShared<FPlayerSaveSnapshot>(FPlayerSaveSnapshot::FromLegacy(*LegacyGame));
+    }
+    return nullptr;
+}
+
+void USaveGameManager::ApplySnapshot(APaperChar* PlayerCharacter, const FPlayerSaveSnapshot& Snapshot)
+{
+    TGuardValue<bool> ApplyingGuard(bApplyingSnapshot, true);
+
+    // Saved on a streamed island: it has to be there before the player is put back on it
+    UIslandStreamingSubsystem* Streaming = UIslandStreamingSubsystem::Get(PlayerCharacter);
+    const FName SavedIsland(*Snapshot.CurrentLevelName);
+    if (Streaming && Streaming->GetCurrentIsland() != SavedIsland && Streaming->CanStream(SavedIsland))
+    {
+        Streaming->StreamIn(SavedIsland, /*bBlock*/ true);
+        Streaming->EnterIsland(SavedIsland);
+    }
 
     // Restore player location and rotation
-    PlayerCharacter->SetActorLocation(LoadedGame->PlayerLocation);
-    PlayerCharacter->SetActorRotation(LoadedGame->PlayerRotation);
+    PlayerCharacter->SetActorLocation(Snapshot.PlayerLocation);
+    PlayerCharacter->SetActorRotation(Snapshot.PlayerRotation);
 
+    ApplyPlayerState(PlayerCharacter, Snapshot);
+}
+
+void USaveGameManager::ApplyPlayerState(APaperChar* PlayerCharacter, const FPlayerSaveSnapshot& Snapshot)
+{
     // Restore health
-    PlayerCharacter->health = LoadedGame->PlayerHealth;
+    // Reset, not gameplay: refreshes the HUD without combat text or death handling
+    PlayerCharacter->Attributes->ResetValue(EAttribute::Health, Snapshot.PlayerHealth);
 
     // Restore inventory
-    PlayerCharacter->MaterialInventory = LoadedGame->MaterialInventory;
-    PlayerCharacter->WeaponInventory = LoadedGame->WeaponInventory;
+    PlayerCharacter->Inventory->Import(Snapshot.MaterialInventory, Snapshot.WeaponInventory);
 
     // Restore quick slots
-    PlayerCharacter->QuickSlots = LoadedGame->QuickSlots;
+    PlayerCharacter->QuickSlots = Snapshot.QuickSlots;
     PlayerCharacter->RefreshQuickSlots();
 
     // Restore equipped armor (convert uint8 back to enum)
     PlayerCharacter->EquippedArmor.Empty();
-    for (const auto& ArmorPair : LoadedGame->EquippedArmorMap)
+    for (const auto& ArmorPair : Snapshot.EquippedArmorMap)
     {
         PlayerCharacter->EquippedArmor.Add(static_cast<EArmorSlot>(ArmorPair.Key), ArmorPair.Value);
     }
 
     // Restore stats
-    PlayerCharacter->BaseDefense = LoadedGame->BaseDefense;
-    PlayerCharacter->BaseAttack = LoadedGame->BaseAttack;
+    PlayerCharacter->BaseDefense = Snapshot.BaseDefense;
+    PlayerCharacter->BaseAttack = Snapshot.BaseAttack;
     PlayerCharacter->RecalculateStats();
 
     // Restore equipped weapon
-    if (!LoadedGame->EquippedWeaponName.IsNone())
+    if (!Snapshot.EquippedWeaponName.IsNone())
     {
         // Find weapon in inventory
-        for (int i = 0; i < PlayerCharacter->WeaponInventory.Num(); ++i)
+        const FItemId WeaponId = GetGameInstance()->GetSubsystem<UItemDatabase>()->FindItemId(Snapshot.EquippedWeaponName);
+        const int32 WeaponIndex = PlayerCharacter->Inventory->FindWeaponIndex(WeaponId);
+        if (WeaponIndex != INDEX_NONE)
         {
-            if (PlayerCharacter->WeaponInventory[i] == LoadedGame->EquippedWeaponName)
-            {
-                PlayerCharacter->EquipWeapon(i);
-                break;
-            }
+            PlayerCharacter->EquipWeapon(WeaponIndex);
         }
     }
+}
 
-    // Update UI
-  //  if (PlayerCharacter->PlayerUIWidget)
-  //  {
-  //      PlayerCharacter->PlayerUIWidget->SetHealthText(PlayerCharacter->health);
-  //  }
+void USaveGameManager::HandleInventoryChanged(TArrayView<const FInventoryDelta> Deltas)
+{
+    const UItemDatabase* ItemDB = GetGameInstance()->GetSubsystem<UItemDatabase>();
 
-    UE_LOG(LogTemp, Log, TEXT("Game loaded successfully from slot: %s"), *SlotName);
-    return true;
+    // Restoring a save is not a change to it
+    for (const FInventoryDelta& Delta : Deltas)
+    {
+        if (Delta.Reason == EInventoryChangeReason::Loaded)
+            continue;
+
+        bHasUnsavedChanges = true;
+
+        const FItemData* Item = ItemDB ? ItemDB->GetItem(Delta.ItemId) : nullptr;
+        if (Item)
+        {
+            AppendRecord(FSaveJournalRecord::MakeItemCount(ItemDB->GetItemName(Delta.ItemId), Delta.NewCount, Item->ItemType == EItemType::Weapon));
+        }
+    }
 }
 
 bool USaveGameManager::DoesSaveExist(const FString& SlotName)
 {
-    return UGameplayStatics::DoesSaveGameExist(SlotName, 0);
+    return KnownSnapshots.Contains(SlotName)
+        || SlotInfos.Contains(SlotName)
+        || IFileManager::Get().FileExists(*GetSlotFilePath(SlotName))
+        || IFileManager::Get().FileExists(*GetJournalFilePath(SlotName))
+        || UGameplayStatics::DoesSaveGameExist(SlotName, 0);
 }
 
 bool USaveGameManager::DeleteSave(const FString& SlotName)
 {
-    bool bSuccess = UGameplayStatics::DeleteGameInSlot(SlotName, 0);
+    const FString FilePath = GetSlotFilePath(SlotName);
+    const FString JournalPath = GetJournalFilePath(SlotName);
+    const bool bHadLegacy = UGameplayStatics::DoesSaveGameExist(SlotName, 0);
+    const bool bHadSave = bHadLegacy || KnownSnapshots.Contains(SlotName) || SlotInfos.Contains(SlotName)
+        || IFileManager::Get().FileExists(*FilePath) || IFileManager::Get().FileExists(*JournalPath);
+    if (!bHadSave)
+        return false;
 
-    if (bSuccess)
+    // Writes and reads of the slot still in flight finish, but their results are dropped
+    ++SlotGenerations.FindOrAdd(SlotName);
+    KnownSnapshots.Remove(SlotName);
+
+    // Only the active slot is the game being played; deleting an old autosave or quick save from a
+    // menu must not wipe bridges and islands that the next autosave would then write out
+    if (SlotName == ActiveSlot)
     {
-        CurrentSaveData = nullptr;
-        UE_LOG(LogTemp, Log, TEXT("Save deleted: %s"), *SlotName);
+        PendingRecords.Reset();
+        JournalRecordCount = 0;
+        bActiveSlotCurrent = false;
+
+        CurrentSnapshot.Reset();
+        BuiltBridges.Reset();
+        Islands.Reset();
+        DirtyIslands.Reset();
+        LoadedPlayTime = 0.0f;
+        PlayTimeStart = FPlatformTime::Seconds();
     }
 
+    // Behind every write already on the pipe, so none of them can bring the files back
+    SavePipe.Launch(TEXT("DeleteSaveGame"), [SlotName, FilePath, JournalPath]()
+    {
+        IFileManager::Get().Delete(*JournalPath, /*RequireExists*/ false, /*EvenReadOnly*/ true, /*Quiet*/ true);
+        if (!IFileManager::Get().Delete(*FilePath, /*RequireExists*/ false, /*EvenReadOnly*/ true))
+        {
+            UE_LOG(LogTemp, Error, TEXT("Failed to delete save file for slot: %s"), *SlotName);
+        }
+    });
+
+    const bool bSuccess = !bHadLegacy || UGameplayStatics::DeleteGameInSlot(SlotName, 0);
+
+    if (SlotInfos.Remove(SlotName) > 0)
+    {
+        WriteSlotIndex();
+    }
+    UE_LOG(LogTemp, Log, TEXT("Save deleted: %s"), *SlotName);
+
     return bSuccess;
 }
 
 void USaveGameManager::RegisterBuiltBridge(FName BridgeID)
 {
-    if (!CurrentSaveData)
-    {
-        // Create a temporary save data if none exists
-        CurrentSaveData = Cast<UBridgeAndBladeSaveGame>(
-            UGameplayStatics::CreateSaveGameObject(UBridgeAndBladeSaveGame::StaticClass())
-        );
-    }
+    bool bAlreadyBuilt = false;
+    BuiltBridges.Add(BridgeID, &bAlreadyBuilt);
 
-    if (CurrentSaveData)
+    if (!bAlreadyBuilt)
     {
-        CurrentSaveData->BuiltBridges.Add(BridgeID, true);
+        bHasUnsavedChanges = true;
+        AppendRecord(FSaveJournalRecord::MakeBridge(BridgeID));
+        RequestAutosave(EAutosaveTrigger::BridgeBuilt);
         UE_LOG(LogTemp, Log, TEXT("Bridge registered as built: %s"), *BridgeID.ToString());
     }
 }
 
 bool USaveGameManager::IsBridgeBuilt(FName BridgeID) const
 {
-    if (!CurrentSaveData)
-        return false;
+    return BuiltBridges.Contains(BridgeID);
+}
+
+int32 USaveGameManager::GetIslandSeed(FName IslandName)
+{
+    FIslandWorldState& State = Islands.FindOrAdd(IslandName);
+    if (State.Seed == 0)
+    {
+        // 0 means unvisited
+        State.Seed = FMath::RandRange(1, MAX_int32);
+        MarkIslandDirty(IslandName, INDEX_NONE);
+    }
+    return State.Seed;
+}
+
+bool USaveGameManager::IsPropHarvested(FName IslandName, int32 PropIndex) const
+{
+    const FIslandWorldState* State = Islands.Find(IslandName);
+    return State && State->IsHarvested(PropIndex);
+}
 
-    return CurrentSaveData->BuiltBridges.Contains(BridgeID) && CurrentSaveData->BuiltBridges[BridgeID];
-}
\ No newline at end of file
+void USaveGameManager::MarkPropHarvested(FName IslandName, int32 PropIndex)
+{
+    const int32 ChunkIndex = Islands.FindOrAdd(IslandName).SetHarvested(PropIndex);
+    if (ChunkIndex != INDEX_NONE)
+    {
+        MarkIslandDirty(IslandName, ChunkIndex);
+    }
+}
+
+void USaveGameManager::RegisterPlacedObject(FName IslandName, FName ItemName, const FVector& Location, float Yaw)
+{
+    FPlacedObject& Placed = Islands.FindOrAdd(IslandName).PlacedObjects.AddDefaulted_GetRef();
+    Placed.ItemName = ItemName;
+    Placed.Location = Location;
+    Placed.Yaw = Yaw;
+    MarkIslandDirty(IslandName, INDEX_NONE);
+}
+
+void USaveGameManager::CaptureIslandEnemies(UWorld* World)
+{
+    const AIslandGameMode* GameMode = World ? World->GetAuthGameMode<AIslandGameMode>() : nullptr;
+    if (!GameMode)
+        return;
+
+    TArray<FSavedEnemy> Enemies;
+    if (!GameMode->CaptureEnemies(Enemies))
+        return;
+
+    const FName IslandName = GameMode->GetIslandName();
+    FIslandWorldState& State = Islands.FindOrAdd(IslandName);
+    if (Enemies.Num() > 0 || State.Enemies.Num() > 0)
+    {
+        State.Enemies = MoveTemp(Enemies);
+        MarkIslandDirty(IslandName, INDEX_NONE);
+    }
+}
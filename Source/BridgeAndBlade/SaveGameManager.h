@@ -3,42 +3,221 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "UObject/NoExportTypes.h"
-#include "BridgeAndBladeSaveGame.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Engine/TimerHandle.h"
+#include "Tasks/Pipe.h"
+#include "PlayerSaveSnapshot.h"
+#include "SaveJournal.h"
 #include "SaveGameManager.generated.h"
 
 class APaperChar;
 class ABridgeZone;
+struct FInventoryDelta;
+
+// What a load / continue menu shows for one slot, without opening it
+USTRUCT(BlueprintType)
+struct FSaveSlotInfo
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Save System")
+    FString SlotName;
+
+    // When the slot was last written (UTC)
+    UPROPERTY(BlueprintReadOnly, Category = "Save System")
+    FDateTime Timestamp;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Save System")
+    FString LevelName;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Save System")
+    int32 PlayerHealth = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Save System")
+    float PlayTimeSeconds = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Save System")
+    int32 BridgesBuilt = 0;
+
+    // Screenshot for the slot, empty if there is none
+    UPROPERTY(BlueprintReadOnly, Category = "Save System")
+    FString ThumbnailPath;
+};
+
+// Why an autosave was asked for
+UENUM(BlueprintType)
+enum class EAutosaveTrigger : uint8
+{
+    Timer,
+    Craft,
+    BridgeBuilt,
+    Equip
+};
+
+// Autosave timings, for the log and for tuning SaveGame.Autosave*
+USTRUCT(BlueprintType)
+struct FAutosaveStats
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Save System")
+    int32 Saves = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Save System")
+    int32 Failures = 0;
+
+    // Requests folded into an autosave that was already scheduled
+    UPROPERTY(BlueprintReadOnly, Category = "Save System")
+    int32 Coalesced = 0;
+
+    // Game thread time spent capturing the snapshot
+    UPROPERTY(BlueprintReadOnly, Category = "Save System")
+    float LastCaptureMs = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Save System")
+    float MaxCaptureMs = 0.0f;
+
+    // Capture to file written, background part included
+    UPROPERTY(BlueprintReadOnly, Category = "Save System")
+    float LastTotalMs = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Save System")
+    float MaxTotalMs = 0.0f;
+};
+
+// Result of a background save, delivered on the game thread
+DECLARE_DELEGATE_OneParam(FOnSaveGameComplete, bool /*bSuccess*/);
+
+// A deferred load finished applying (or found nothing to apply); bridges re-read their state
+DECLARE_MULTICAST_DELEGATE(FOnSaveApplied);
 
 /**
+ * Saving and loading for one game instance. Lives as long as the game instance, so the loaded
+ * save and the dirty flag survive level travel but are never shared between PIE clients.
+ *
+ * Saving captures an FPlayerSaveSnapshot on the game thread and hands it to a worker that
+ * serializes, compresses and writes it (temp file + rename, so a slot is never half written).
+ * Writes go through one pipe and complete in the order they were issued.
  *
+ * The player's slot is read and parsed on a worker as soon as the game instance starts, in
+ * parallel with the first level load. The player asks for it with LoadGameDeferred, and it is
+ * applied on the tick after both sides are ready. Snapshots are cached per slot, so loading after
+ * level travel doesn't touch the disk at all.
+ *
+ * With SaveGame.Journal on, inventory changes and bridge builds are also appended to the active
+ * slot's (PlayerSaveSlot's) journal as they happen, and SaveCheckpoint journals the rest of the player state, so
+ * autosaving costs a few small records. Equipment changes and the SaveGame.CheckpointInterval
+ * timer journal checkpoints, so replaying the journal never separates an equip from its inventory
+ * change. Once SaveGame.JournalCompactThreshold records pile up, a pipe task folds the journal
+ * into the base snapshot; a full save or a load does the same. Loading any other slot copies it
+ * into the active slot, so the journal always extends the game startup will read back.
+ *
+ * Every slot write also rewrites SlotIndex.bbindex, a small file of FSaveSlotInfo summaries,
+ * so listing slots is one read at startup instead of one full load per slot.
+ *
+ * Autosaves go to AutosaveA and AutosaveB in turn, so the newest autosave can be lost to a bad
+ * write but the one before it can't. They are requested by the SaveGame.AutosaveInterval timer
+ * (only when something changed) and by crafting, bridge building and equipping, and are held to
+ * one per SaveGame.AutosaveMinInterval seconds; requests in between fold into one scheduled save.
+ * At startup the player continues from whichever of PlayerSaveSlot and the newest autosave was
+ * written last (GetStartupSlot), so a crash after an autosave doesn't roll back to the last full save.
+ *
+ * Bridge travel doesn't go through the slot: CarryPlayerState hands the snapshot to
+ * UPlayerStateCarrier and the next level's player is hydrated from it, while the same snapshot is
+ * written on the pipe without anyone waiting for it.
+ *
+ * Islands are saved as a seed plus what the player changed (FIslandWorldState). Harvests only
+ * mark their 64-prop chunk dirty; each flush journals the dirty chunks once, however many props in
+ * them went that frame.
  */
 UCLASS()
-class BRIDGEANDBLADE_API USaveGameManager : public UObject
+class BRIDGEANDBLADE_API USaveGameManager : public UGameInstanceSubsystem
 {
     GENERATED_BODY()
 
 public:
-    // Get singleton instance
-    UFUNCTION(BlueprintCallable, Category = "Save System")
-    static USaveGameManager* Get(UObject* WorldContextObject);
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    // Save manager of the game instance WorldContextObject belongs to (nullptr outside a game instance)
+    UFUNCTION(BlueprintCallable, Category = "Save System", meta = (WorldContext = "WorldContextObject"))
+    static USaveGameManager* Get(const UObject* WorldContextObject);
 
-    // Save the game
+    // Save the game in the background. Returns whether the save was started, not whether it succeeded.
     UFUNCTION(BlueprintCallable, Category = "Save System")
     bool SaveGame(APaperChar* PlayerCharacter, const FString& SlotName = TEXT("PlayerSaveSlot"));
 
-    // Load the game
+    // Same, with OnComplete called on the game thread once the file is written (or failed)
+    bool SaveGameAsync(APaperChar* PlayerCharacter, const FString& SlotName, FOnSaveGameComplete OnComplete);
+
+    // Hand the player's state to UPlayerStateCarrier for DestinationLevel and save SlotName in the
+    // background from the same snapshot. Travel can open the level right away.
+    bool CarryPlayerState(APaperChar* PlayerCharacter, FName DestinationLevel, const FString& SlotName = TEXT("PlayerSaveSlot"));
+
+    // Load the game now (synchronous if the slot isn't cached yet)
     UFUNCTION(BlueprintCallable, Category = "Save System")
     bool LoadGame(APaperChar* PlayerCharacter, const FString& SlotName = TEXT("PlayerSaveSlot"));
 
+    // Start reading SlotName in the background, if it isn't cached or already being read
+    void PreloadSlot(const FString& SlotName);
+
+    // Apply SlotName to PlayerCharacter once it has been read, outside the caller's frame; state
+    // carried over from the previous level takes its place. OnSaveApplied fires afterwards even if there was no save.
+    void LoadGameDeferred(APaperChar* PlayerCharacter, const FString& SlotName = TEXT("PlayerSaveSlot"));
+
+    FOnSaveApplied OnSaveApplied;
+
     // Check if a save exists
     UFUNCTION(BlueprintCallable, Category = "Save System")
     bool DoesSaveExist(const FString& SlotName = TEXT("PlayerSaveSlot"));
 
-    // Delete a save
+    // Every indexed slot, newest first
+    UFUNCTION(BlueprintCallable, Category = "Save System")
+    TArray<FSaveSlotInfo> GetSaveSlots() const;
+
+    UFUNCTION(BlueprintCallable, Category = "Save System")
+    bool GetSaveSlotInfo(const FString& SlotName, FSaveSlotInfo& OutInfo) const;
+
+    // Attach a screenshot (or any image path) to an indexed slot
+    UFUNCTION(BlueprintCallable, Category = "Save System")
+    void SetSlotThumbnail(const FString& SlotName, const FString& ThumbnailPath);
+
+    // Seconds played on the loaded save, this session included
+    UFUNCTION(BlueprintPure, Category = "Save System")
+    float GetPlayTimeSeconds() const;
+
+    // Delete a save; the files are removed on the save pipe, after any writes already queued for it.
+    // Deleting the active slot also starts the session's world state over; other slots are just files.
     UFUNCTION(BlueprintCallable, Category = "Save System")
     bool DeleteSave(const FString& SlotName = TEXT("PlayerSaveSlot"));
 
+    // Journal position, health, equipment and quick slots (inventory and bridges are journaled as they change).
+    // Falls back to a full save when journaling is off.
+    UFUNCTION(BlueprintCallable, Category = "Save System")
+    bool SaveCheckpoint(APaperChar* PlayerCharacter);
+
+    // The player equipped or took off something: journals a checkpoint and asks for an autosave
+    void HandleEquipmentChanged(APaperChar* PlayerCharacter);
+
+    // Ask for an autosave; runs next tick, or once the minimum interval since the last one has passed
+    UFUNCTION(BlueprintCallable, Category = "Save System")
+    void RequestAutosave(EAutosaveTrigger Trigger);
+
+    // Newer of the two autosave slots, empty if neither has been written
+    UFUNCTION(BlueprintCallable, Category = "Save System")
+    FString GetLatestAutosaveSlot() const;
+
+    // Slot to continue from: PlayerSaveSlot, unless the newest autosave was written after it
+    UFUNCTION(BlueprintCallable, Category = "Save System")
+    FString GetStartupSlot() const;
+
+    UFUNCTION(BlueprintCallable, Category = "Save System")
+    FAutosaveStats GetAutosaveStats() const { return AutosaveStats; }
+
+    // Whether a background save is still being written
+    UFUNCTION(BlueprintCallable, Category = "Save System")
+    bool IsSaveInProgress() const { return PendingSaves > 0; }
+
     // Bridge state management
     UFUNCTION(BlueprintCallable, Category = "Save System")
     void RegisterBuiltBridge(FName BridgeID);
@@ -46,14 +225,154 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Save System")
     bool IsBridgeBuilt(FName BridgeID) const;
 
-    // Get current save data
+    // Seed IslandName's props are generated from; picked and recorded on the first visit
+    int32 GetIslandSeed(FName IslandName);
+
+    bool IsPropHarvested(FName IslandName, int32 PropIndex) const;
+    void MarkPropHarvested(FName IslandName, int32 PropIndex);
+
+    void RegisterPlacedObject(FName IslandName, FName ItemName, const FVector& Location, float Yaw);
+
+    // nullptr until the island is first visited
+    const FIslandWorldState* FindIslandState(FName IslandName) const { return Islands.Find(IslandName); }
+
+    // Last snapshot saved or loaded (nullptr before the first one)
+    TSharedPtr<const FPlayerSaveSnapshot> GetCurrentSnapshot() const { return CurrentSnapshot; }
+
+    // Whether the player's inventory changed since the last save / load
     UFUNCTION(BlueprintCallable, Category = "Save System")
-    UBridgeAndBladeSaveGame* GetCurrentSaveData() const { return CurrentSaveData; }
+    bool HasUnsavedChanges() const { return bHasUnsavedChanges; }
+
+    // Subscribed to the player's UInventoryComponent::OnInventoryChanged
+    void HandleInventoryChanged(TArrayView<const FInventoryDelta> Deltas);
 
 protected:
-    UPROPERTY()
-    UBridgeAndBladeSaveGame* CurrentSaveData;
+    // Copy the player's saveable state; game thread only
+    TSharedRef<const FPlayerSaveSnapshot> CaptureSnapshot(APaperChar* PlayerCharacter) const;
+
+    // Everything except inventory and bridges
+    void CapturePlayerFields(APaperChar* PlayerCharacter, FPlayerSaveSnapshot& OutSnapshot) const;
+
+    // Journal a checkpoint every SaveGame.CheckpointInterval seconds
+    void HandleCheckpointTimer();
+
+    // (Re)start the SaveGame.AutosaveInterval countdown
+    void ArmAutosaveTimer();
+    void HandleAutosaveTimer();
+    void RunAutosave();
+    void FinishAutosave(bool bSuccess, double StartTime);
+
+    // Ask the island game mode (if any) for its live enemies
+    void CaptureIslandEnemies(UWorld* World);
+
+    // Buffer a journal record for the active slot; written on the next tick
+    void AppendRecord(FSaveJournalRecord&& Record);
+    void MarkIslandDirty(FName IslandName, int32 ChunkIndex);
+    void ScheduleJournalFlush();
+    void FlushJournal();
+
+    // Fold SlotName's journal into its base snapshot on the save pipe
+    void QueueCompaction(const FString& SlotName);
+
+    // Make a just-loaded game the base of the active slot's journal
+    void AdoptLoadedSlot(const FString& SlotName, const TSharedRef<const FPlayerSaveSnapshot>& Snapshot);
+
+    // Serialize and write an already captured snapshot on the save pipe
+    void WriteSnapshot(const FString& SlotName, const TSharedRef<const FPlayerSaveSnapshot>& Snapshot, FOnSaveGameComplete OnComplete);
+
+    void ApplySnapshot(APaperChar* PlayerCharacter, const FPlayerSaveSnapshot& Snapshot);
+
+    // What the player carries (health, inventory, equipment, quick slots, stats), not where they stand
+    void ApplyPlayerState(APaperChar* PlayerCharacter, const FPlayerSaveSnapshot& Snapshot);
+
+    // Cached snapshot, else the snapshot file, else a legacy UGameplayStatics slot
+    TSharedPtr<const FPlayerSaveSnapshot> ReadSlot(const FString& SlotName) const;
+
+    // Snapshot file plus its journal; safe on any thread
+    static TSharedPtr<const FPlayerSaveSnapshot> ReadSnapshotFile(const FString& SlotName);
+
+    // Game thread only (creates a USaveGame)
+    static TSharedPtr<const FPlayerSaveSnapshot> ReadLegacySlot(const FString& SlotName);
+
+    void FinishPreload(const FString& SlotName, int32 Generation, TSharedPtr<const FPlayerSaveSnapshot> Snapshot);
+
+    void ScheduleDeferredLoad();
+    void ApplyDeferredLoad();
+
+    void SetLoadedSnapshot(const TSharedPtr<const FPlayerSaveSnapshot>& Snapshot);
+
+    void FinishSave(const FString& SlotName, int32 Generation, const TSharedRef<const FPlayerSaveSnapshot>& Snapshot, bool bSuccess, const FOnSaveGameComplete& OnComplete);
+
+    // Bumped by DeleteSave; reads and writes started before then no longer count
+    TMap<FString, int32> SlotGenerations;
+    int32 GetSlotGeneration(const FString& SlotName) const { return SlotGenerations.FindRef(SlotName); }
+
+    static FString GetSlotFilePath(const FString& SlotName);
+    static FString GetJournalFilePath(const FString& SlotName);
+    static FString GetSlotIndexFilePath();
+
+    // Summaries of every slot, mirrored to the index file
+    TMap<FString, FSaveSlotInfo> SlotInfos;
+
+    void LoadSlotIndex();
+    void UpdateSlotInfo(const FString& SlotName, const FPlayerSaveSnapshot& Snapshot);
+
+    // Queue a rewrite of the index file behind the slot writes already on the pipe
+    void WriteSlotIndex();
+
+    // Play time of the loaded save, and when this session started adding to it
+    float LoadedPlayTime = 0.0f;
+    double PlayTimeStart = 0.0;
+
+    TSharedPtr<const FPlayerSaveSnapshot> CurrentSnapshot;
+
+    // Newest known contents per slot (captured, written or read); loads prefer it over the disk
+    TMap<FString, TSharedRef<const FPlayerSaveSnapshot>> KnownSnapshots;
+
+    // Slots with a background read in flight
+    TSet<FString> LoadingSlots;
+
+    TWeakObjectPtr<APaperChar> DeferredLoadTarget;
+    FString DeferredLoadSlot;
+    bool bDeferredLoadScheduled = false;
+
+    TSet<FName> BuiltBridges;
+
+    TMap<FName, FIslandWorldState> Islands;
+
+    // Island changes not journaled yet
+    struct FIslandDirtyState
+    {
+        TBitArray<> Chunks;
+        bool bObjects = false;
+    };
+    TMap<FName, FIslandDirtyState> DirtyIslands;
+
+    // Slot that gameplay changes are journaled to; fixed, loads from other slots are copied into it
+    FString ActiveSlot = TEXT("PlayerSaveSlot");
+
+    // The active slot was loaded or written this session, so it is newer than any autosave
+    bool bActiveSlotCurrent = false;
+    TArray<FSaveJournalRecord> PendingRecords;
+    int32 JournalRecordCount = 0;
+    bool bJournalFlushScheduled = false;
+
+    int32 PendingSaves = 0;
+    bool bHasUnsavedChanges = false;
+
+    // Restoring a save equips weapons too; that is not a reason to autosave
+    bool bApplyingSnapshot = false;
+
+    FTimerHandle CheckpointHandle;
+    FTimerHandle AutosaveIntervalHandle;
+    FTimerHandle AutosaveHandle;
+    bool bAutosaveScheduled = false;
+    bool bAutosaveInFlight = false;
+    double LastAutosaveTime = 0.0;
+
+    // Slot the next autosave goes to (0 = A, 1 = B)
+    int32 NextAutosaveSlot = 0;
+    FAutosaveStats AutosaveStats;
 
-private:
-    static USaveGameManager* Instance;
-};
\ No newline at end of file
+    UE::Tasks::FPipe SavePipe{ TEXT("SaveGamePipe") };
+};
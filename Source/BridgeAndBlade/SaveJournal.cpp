@@ -0,0 +1,278 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SaveJournal.h"
+#include "HAL/FileManager.h"
+#include "Misc/Crc.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace
+{
+    // Anything bigger is a corrupt frame, not a record
+    constexpr uint32 MaxRecordSize = 64 * 1024;
+}
+
+FSaveJournalRecord FSaveJournalRecord::MakeItemCount(FName ItemName, int32 NewCount, bool bIsWeapon)
+{
+    FSaveJournalRecord Record;
+    Record.Type = ESaveJournalRecordType::ItemCount;
+    Record.Name = ItemName;
+    Record.Count = NewCount;
+    Record.bWeapon = bIsWeapon;
+    return Record;
+}
+
+FSaveJournalRecord FSaveJournalRecord::MakeBridge(FName BridgeID)
+{
+    FSaveJournalRecord Record;
+    Record.Type = ESaveJournalRecordType::Bridge;
+    Record.Name = BridgeID;
+    return Record;
+}
+
+FSaveJournalRecord FSaveJournalRecord::MakeCheckpoint(const FPlayerSaveSnapshot& Snapshot)
+{
+    FSaveJournalRecord Record;
+    Record.Type = ESaveJournalRecordType::Checkpoint;
+    Record.Checkpoint.PlayerLocation = Snapshot.PlayerLocation;
+    Record.Checkpoint.PlayerRotation = Snapshot.PlayerRotation;
+    Record.Checkpoint.CurrentLevelName = Snapshot.CurrentLevelName;
+    Record.Checkpoint.PlayerHealth = Snapshot.PlayerHealth;
+    Record.Checkpoint.EquippedWeaponName = Snapshot.EquippedWeaponName;
+    Record.Checkpoint.QuickSlots = Snapshot.QuickSlots;
+    Record.Checkpoint.EquippedArmorMap = Snapshot.EquippedArmorMap;
+    Record.Checkpoint.BaseDefense = Snapshot.BaseDefense;
+    Record.Checkpoint.BaseAttack = Snapshot.BaseAttack;
+    Record.Checkpoint.PlayTimeSeconds = Snapshot.PlayTimeSeconds;
+    return Record;
+}
+
+FSaveJournalRecord FSaveJournalRecord::MakeIslandChunk(FName IslandName, const FIslandWorldState& State, int32 ChunkIndex)
+{
+    FSaveJournalRecord Record;
+    Record.Type = ESaveJournalRecordType::IslandChunk;
+    Record.Name = IslandName;
+    Record.Count = ChunkIndex;
+    Record.Bits = State.HarvestedChunks.IsValidIndex(ChunkIndex) ? State.HarvestedChunks[ChunkIndex] : 0;
+    return Record;
+}
+
+FSaveJournalRecord FSaveJournalRecord::MakeIslandObjects(FName IslandName, const FIslandWorldState& State)
+{
+    FSaveJournalRecord Record;
+    Record.Type = ESaveJournalRecordType::IslandObjects;
+    Record.Name = IslandName;
+    Record.Island.Seed = State.Seed;
+    Record.Island.PlacedObjects = State.PlacedObjects;
+    Record.Island.Enemies = State.Enemies;
+    return Record;
+}
+
+void FSaveJournalRecord::ApplyTo(FPlayerSaveSnapshot& Snapshot) const
+{
+    switch (Type)
+    {
+    case ESaveJournalRecordType::ItemCount:
+        if (bWeapon)
+        {
+            // Weapons are instances; drop the newest copies or append new ones to reach Count
+            int32 Owned = 0;
+            for (FName Weapon : Snapshot.WeaponInventory)
+            {
+                Owned += Weapon == Name ? 1 : 0;
+            }
+            for (int32 Index = Snapshot.WeaponInventory.Num() - 1; Index >= 0 && Owned > Count; --Index)
+            {
+                if (Snapshot.WeaponInventory[Index] == Name)
+                {
+                    Snapshot.WeaponInventory.RemoveAt(Index);
+                    --Owned;
+                }
+            }
+            for (; Owned < Count; ++Owned)
+            {
+                Snapshot.WeaponInventory.Add(Name);
+            }
+        }
+        else if (Count > 0)
+        {
+            Snapshot.MaterialInventory.Add(Name, Count);
+        }
+        else
+        {
+            Snapshot.MaterialInventory.Remove(Name);
+        }
+        break;
+
+    case ESaveJournalRecordType::Bridge:
+        Snapshot.BuiltBridges.AddUnique(Name);
+        break;
+
+    case ESaveJournalRecordType::Checkpoint:
+        Snapshot.PlayerLocation = Checkpoint.PlayerLocation;
+        Snapshot.PlayerRotation = Checkpoint.PlayerRotation;
+        Snapshot.CurrentLevelName = Checkpoint.CurrentLevelName;
+        Snapshot.PlayerHealth = Checkpoint.PlayerHealth;
+        Snapshot.EquippedWeaponName = Checkpoint.EquippedWeaponName;
+        Snapshot.QuickSlots = Checkpoint.QuickSlots;
+        Snapshot.EquippedArmorMap = Checkpoint.EquippedArmorMap;
+        Snapshot.BaseDefense = Checkpoint.BaseDefense;
+        Snapshot.BaseAttack = Checkpoint.BaseAttack;
+        Snapshot.PlayTimeSeconds = Checkpoint.PlayTimeSeconds;
+        break;
+
+    case ESaveJournalRecordType::IslandChunk:
+        Snapshot.Islands.FindOrAdd(Name).SetChunk(Count, Bits);
+        break;
+
+    case ESaveJournalRecordType::IslandObjects:
+        {
+            FIslandWorldState& State = Snapshot.Islands.FindOrAdd(Name);
+            State.Seed = Island.Seed;
+            State.PlacedObjects = Island.PlacedObjects;
+            State.Enemies = Island.Enemies;
+        }
+        break;
+    }
+}
+
+void FSaveJournalRecord::Serialize(FArchive& Ar)
+{
+    uint8 RawType = (uint8)Type;
+    Ar << RawType;
+    Type = (ESaveJournalRecordType)RawType;
+
+    switch (Type)
+    {
+    case ESaveJournalRecordType::ItemCount:
+        Ar << Name << Count << bWeapon;
+        break;
+
+    case ESaveJournalRecordType::Bridge:
+        Ar << Name;
+        break;
+
+    case ESaveJournalRecordType::Checkpoint:
+        Ar << Checkpoint.PlayerLocation << Checkpoint.PlayerRotation << Checkpoint.CurrentLevelName << Checkpoint.PlayerHealth;
+        Ar << Checkpoint.EquippedWeaponName << Checkpoint.QuickSlots << Checkpoint.EquippedArmorMap;
+        Ar << Checkpoint.BaseDefense << Checkpoint.BaseAttack << Checkpoint.PlayTimeSeconds;
+        break;
+
+    case ESaveJournalRecordType::IslandChunk:
+        Ar << Name << Count << Bits;
+        break;
+
+    case ESaveJournalRecordType::IslandObjects:
+        {
+            Ar << Name << Island.Seed;
+
+            int32 NumPlaced = Island.PlacedObjects.Num();
+            Ar << NumPlaced;
+            if (Ar.IsLoading())
+            {
+                // Bounded by the frame size; each entry is well over a byte
+                if (NumPlaced < 0 || NumPlaced > (int32)MaxRecordSize)
+                {
+                    Ar.SetError();
+                    break;
+                }
+                Island.PlacedObjects.SetNum(NumPlaced);
+            }
+            for (FPlacedObject& Placed : Island.PlacedObjects)
+            {
+                Ar << Placed.ItemName << Placed.Location << Placed.Yaw;
+            }
+
+            int32 NumEnemies = Island.Enemies.Num();
+            Ar << NumEnemies;
+            if (Ar.IsLoading())
+            {
+                if (NumEnemies < 0 || NumEnemies > (int32)MaxRecordSize)
+                {
+                    Ar.SetError();
+                    break;
+                }
+                Island.Enemies.SetNum(NumEnemies);
+            }
+            for (FSavedEnemy& Enemy : Island.Enemies)
+            {
+                Ar << Enemy.Archetype << Enemy.Location << Enemy.Health;
+            }
+        }
+        break;
+
+    default:
+        Ar.SetError();
+        break;
+    }
+}
+
+bool SaveJournal::Append(const FString& FilePath, TArrayView<const FSaveJournalRecord> Records)
+{
+    // Frame every record as [size][crc][payload] and write the batch in one go
+    TArray<uint8> Bytes;
+    FMemoryWriter Ar(Bytes, /*bIsPersistent*/ true);
+
+    TArray<uint8> Payload;
+    for (const FSaveJournalRecord& Record : Records)
+    {
+        Payload.Reset();
+        FMemoryWriter PayloadWriter(Payload, /*bIsPersistent*/ true);
+        FSaveJournalRecord Copy = Record;
+        Copy.Serialize(PayloadWriter);
+
+        uint32 Size = Payload.Num();
+        uint32 Crc = FCrc::MemCrc32(Payload.GetData(), Payload.Num());
+        Ar << Size << Crc;
+        Ar.Serialize(Payload.GetData(), Payload.Num());
+    }
+
+    TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*FilePath, FILEWRITE_Append));
+    if (!Writer)
+        return false;
+
+    Writer->Serialize(Bytes.GetData(), Bytes.Num());
+    Writer->Flush();
+    return Writer->Close();
+}
+
+int32 SaveJournal::Replay(const FString& FilePath, FPlayerSaveSnapshot& InOutSnapshot)
+{
+    TArray<uint8> Bytes;
+    if (!FFileHelper::LoadFileToArray(Bytes, *FilePath, FILEREAD_Silent))
+        return 0;
+
+    FMemoryReader Ar(Bytes, /*bIsPersistent*/ true);
+    int32 Applied = 0;
+
+    while (Ar.Tell() + 2 * (int64)sizeof(uint32) <= Ar.TotalSize())
+    {
+        uint32 Size = 0;
+        uint32 Crc = 0;
+        Ar << Size << Crc;
+
+        const int64 Start = Ar.Tell();
+        if (Size > MaxRecordSize || Start + Size > Ar.TotalSize()
+            || FCrc::MemCrc32(Bytes.GetData() + Start, Size) != Crc)
+        {
+            // Torn or corrupt tail; everything after it is unreliable
+            UE_LOG(LogTemp, Warning, TEXT("SaveJournal: %s is cut off after %d records"), *FilePath, Applied);
+            break;
+        }
+
+        TArray<uint8> Payload(Bytes.GetData() + Start, Size);
+        FMemoryReader PayloadReader(Payload, /*bIsPersistent*/ true);
+
+        FSaveJournalRecord Record;
+        Record.Serialize(PayloadReader);
+        if (PayloadReader.IsError())
+            break;
+
+        Record.ApplyTo(InOutSnapshot);
+        ++Applied;
+        Ar.Seek(Start + Size);
+    }
+
+    return Applied;
+}
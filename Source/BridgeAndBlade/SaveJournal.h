@@ -0,0 +1,72 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PlayerSaveSnapshot.h"
+
+enum class ESaveJournalRecordType : uint8
+{
+    // Absolute count of one item
+    ItemCount,
+
+    // A bridge was built
+    Bridge,
+
+    // Position, health, equipment, quick slots and stats (everything but inventory and bridges)
+    Checkpoint,
+
+    // One island's harvested-prop chunk
+    IslandChunk,
+
+    // One island's seed, placed objects and enemies
+    IslandObjects
+};
+
+/**
+ * One gameplay change, as appended to a slot's journal. Every record is absolute (new count,
+ * full checkpoint), so replaying a record that is already folded into the base is harmless.
+ */
+struct BRIDGEANDBLADE_API FSaveJournalRecord
+{
+    ESaveJournalRecordType Type = ESaveJournalRecordType::ItemCount;
+
+    // ItemCount, Bridge, island name for the island records
+    FName Name;
+
+    // ItemCount; chunk index for IslandChunk
+    int32 Count = 0;
+    bool bWeapon = false;
+
+    // IslandChunk
+    uint64 Bits = 0;
+
+    // Checkpoint; only the player fields are used
+    FPlayerSaveSnapshot Checkpoint;
+
+    // IslandObjects; harvested chunks are not used
+    FIslandWorldState Island;
+
+    static FSaveJournalRecord MakeItemCount(FName ItemName, int32 NewCount, bool bIsWeapon);
+    static FSaveJournalRecord MakeBridge(FName BridgeID);
+    static FSaveJournalRecord MakeCheckpoint(const FPlayerSaveSnapshot& Snapshot);
+    static FSaveJournalRecord MakeIslandChunk(FName IslandName, const FIslandWorldState& State, int32 ChunkIndex);
+    static FSaveJournalRecord MakeIslandObjects(FName IslandName, const FIslandWorldState& State);
+
+    void ApplyTo(FPlayerSaveSnapshot& Snapshot) const;
+
+    void Serialize(FArchive& Ar);
+};
+
+/**
+ * Per-slot append-only log next to the base snapshot (<Slot>.bbjournal). Records are framed
+ * with their size and CRC, so a write cut off by a crash only loses the torn tail. All of this
+ * is plain file I/O and runs on USaveGameManager's save pipe.
+ */
+namespace SaveJournal
+{
+    BRIDGEANDBLADE_API bool Append(const FString& FilePath, TArrayView<const FSaveJournalRecord> Records);
+
+    // Apply every intact record in FilePath to InOutSnapshot; returns how many were applied
+    BRIDGEANDBLADE_API int32 Replay(const FString& FilePath, FPlayerSaveSnapshot& InOutSnapshot);
+}
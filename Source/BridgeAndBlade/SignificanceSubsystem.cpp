@@ -0,0 +1,267 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SignificanceSubsystem.h"
+#include "PaperBase.h"
+#include "PaperFlipbookComponent.h"
+#include "Components/CapsuleComponent.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/Controller.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Kismet/GameplayStatics.h"
+#include "Engine/World.h"
+
+DECLARE_STATS_GROUP(TEXT("Significance"), STATGROUP_Significance, STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT(TEXT("High"), STAT_SignificanceHigh, STATGROUP_Significance);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Medium"), STAT_SignificanceMedium, STATGROUP_Significance);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Low"), STAT_SignificanceLow, STATGROUP_Significance);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Dormant"), STAT_SignificanceDormant, STATGROUP_Significance);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Tier Changes"), STAT_SignificanceTierChanges, STATGROUP_Significance);
+
+USignificanceSubsystem::USignificanceSubsystem()
+{
+    // Defaults, overridable from [/Script/BridgeAndBlade.SignificanceSubsystem] in DefaultGame.ini
+    TierSettings.SetNum((int32)ESignificanceTier::Count);
+
+    FSignificanceTierSettings& High = TierSettings[(int32)ESignificanceTier::High];
+    High.MaxDistance = 1500.0f;
+
+    FSignificanceTierSettings& Medium = TierSettings[(int32)ESignificanceTier::Medium];
+    Medium.MaxDistance = 3000.0f;
+    Medium.TickInterval = 0.1f;
+    Medium.AnimationTickInterval = 0.05f;
+    Medium.MovementTickInterval = 0.033f;
+
+    FSignificanceTierSettings& Low = TierSettings[(int32)ESignificanceTier::Low];
+    Low.MaxDistance = 6000.0f;
+    Low.TickInterval = 0.25f;
+    Low.AnimationTickInterval = -1.0f;
+    Low.MovementTickInterval = 0.1f;
+    Low.bGenerateOverlapEvents = false;
+
+    FSignificanceTierSettings& Dormant = TierSettings[(int32)ESignificanceTier::Dormant];
+    Dormant.TickInterval = 1.0f;
+    Dormant.AnimationTickInterval = -1.0f;
+    Dormant.MovementTickInterval = 0.5f;
+    Dormant.bGenerateOverlapEvents = false;
+}
+
+bool USignificanceSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void USignificanceSubsystem::Deinitialize()
+{
+    for (APaperBase* Actor : Actors)
+    {
+        if (Actor)
+        {
+            Actor->SignificanceIndex = INDEX_NONE;
+        }
+    }
+
+    Actors.Empty();
+    Tiers.Empty();
+    TierEnteredTimes.Empty();
+    FMemory::Memzero(TierCounts);
+    EvaluationCursor = 0;
+
+    Super::Deinitialize();
+}
+
+TStatId USignificanceSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(USignificanceSubsystem, STATGROUP_Tickables);
+}
+
+USignificanceSubsystem* USignificanceSubsystem::Get(const UObject* WorldContextObject)
+{
+    UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    return World ? World->GetSubsystem<USignificanceSubsystem>() : nullptr;
+}
+
+void USignificanceSubsystem::Register(APaperBase* Actor)
+{
+    if (!Actor || Actor->SignificanceIndex != INDEX_NONE)
+        return;
+
+    Actor->SignificanceIndex = Actors.Add(Actor);
+    Tiers.Add(ESignificanceTier::High);
+    TierEnteredTimes.Add(GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f);
+    ++TierCounts[(int32)ESignificanceTier::High];
+}
+
+void USignificanceSubsystem::Unregister(APaperBase* Actor)
+{
+    if (!Actor || !Actors.IsValidIndex(Actor->SignificanceIndex) || Actors[Actor->SignificanceIndex] != Actor)
+        return;
+
+    const int32 Index = Actor->SignificanceIndex;
+    Actor->SignificanceIndex = INDEX_NONE;
+    --TierCounts[(int32)Tiers[Index]];
+
+    Actors.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    Tiers.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    TierEnteredTimes.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+
+    // The last entry moved into the freed slot
+    if (Actors.IsValidIndex(Index) && Actors[Index])
+    {
+        Actors[Index]->SignificanceIndex = Index;
+    }
+}
+
+ESignificanceTier USignificanceSubsystem::GetTier(const APaperBase* Actor) const
+{
+    if (Actor && Tiers.IsValidIndex(Actor->SignificanceIndex))
+    {
+        return Tiers[Actor->SignificanceIndex];
+    }
+    return ESignificanceTier::High;
+}
+
+const FSignificanceTierSettings& USignificanceSubsystem::GetSettings(ESignificanceTier Tier) const
+{
+    static const FSignificanceTierSettings FullRate;
+    return TierSettings.IsValidIndex((int32)Tier) ? TierSettings[(int32)Tier] : FullRate;
+}
+
+void USignificanceSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    UWorld* World = GetWorld();
+    const int32 Num = Actors.Num();
+    if (!World || Num == 0)
+        return;
+
+    // Score against the player; fall back to the camera when there is no pawn (e.g. during travel)
+    FVector ViewerLocation;
+    if (APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(World, 0))
+    {
+        ViewerLocation = PlayerPawn->GetActorLocation();
+    }
+    else if (APlayerCameraManager* CameraManager = UGameplayStatics::GetPlayerCameraManager(World, 0))
+    {
+        ViewerLocation = CameraManager->GetCameraLocation();
+    }
+    else
+    {
+        return;
+    }
+
+    const float Now = World->GetTimeSeconds();
+    const int32 Budget = FMath::Min(Num, FMath::Max(1, MaxEvaluationsPerFrame));
+    int32 TierChanges = 0;
+
+    for (int32 Step = 0; Step < Budget; ++Step)
+    {
+        if (EvaluationCursor >= Num)
+        {
+            EvaluationCursor = 0;
+        }
+        const int32 i = EvaluationCursor++;
+
+        APaperBase* Actor = Actors[i];
+        if (!Actor)
+            continue;
+
+        const ESignificanceTier NewTier = ScoreActor(Actor, Tiers[i], Now - TierEnteredTimes[i], ViewerLocation);
+        if (NewTier == Tiers[i])
+            continue;
+
+        --TierCounts[(int32)Tiers[i]];
+        ++TierCounts[(int32)NewTier];
+        Tiers[i] = NewTier;
+        TierEnteredTimes[i] = Now;
+        ++TierChanges;
+
+        ApplyTier(Actor, NewTier);
+    }
+
+    SET_DWORD_STAT(STAT_SignificanceHigh, TierCounts[(int32)ESignificanceTier::High]);
+    SET_DWORD_STAT(STAT_SignificanceMedium, TierCounts[(int32)ESignificanceTier::Medium]);
+    SET_DWORD_STAT(STAT_SignificanceLow, TierCounts[(int32)ESignificanceTier::Low]);
+    SET_DWORD_STAT(STAT_SignificanceDormant, TierCounts[(int32)ESignificanceTier::Dormant]);
+    SET_DWORD_STAT(STAT_SignificanceTierChanges, TierChanges);
+}
+
+ESignificanceTier USignificanceSubsystem::ScoreActor(const APaperBase* Actor, ESignificanceTier CurrentTier, float TimeInTier, const FVector& ViewerLocation) const
+{
+    // The player always runs at full rate
+    if (Actor->IsPlayerControlled())
+        return ESignificanceTier::High;
+
+    const float Distance = FVector::Dist2D(Actor->GetActorLocation(), ViewerLocation);
+    const bool bVisible = Actor->WasRecentlyRendered(VisibilityGracePeriod);
+
+    auto TierForDistance = [&](float Scale)
+    {
+        int32 Tier = (int32)ESignificanceTier::High;
+        while (Tier < (int32)ESignificanceTier::Dormant && Distance >= GetSettings((ESignificanceTier)Tier).MaxDistance * Scale)
+        {
+            ++Tier;
+        }
+
+        // Full rate needs to be on screen; anything on screen stays at least Medium
+        if (bVisible)
+        {
+            Tier = FMath::Min(Tier, (int32)ESignificanceTier::Medium);
+        }
+        else
+        {
+            Tier = FMath::Max(Tier, (int32)ESignificanceTier::Medium);
+        }
+        return Tier;
+    };
+
+    const int32 Current = (int32)CurrentTier;
+    const int32 Candidate = TierForDistance(1.0f);
+
+    // Promote straight away so nothing visibly stutters
+    if (Candidate <= Current)
+        return (ESignificanceTier)Candidate;
+
+    if (TimeInTier < MinTimeInTier)
+        return CurrentTier;
+
+    // Demote only as far as the widened bands allow
+    return (ESignificanceTier)FMath::Max(Current, TierForDistance(1.0f + HysteresisFraction));
+}
+
+void USignificanceSubsystem::ApplyTier(APaperBase* Actor, ESignificanceTier Tier) const
+{
+    const FSignificanceTierSettings& Settings = GetSettings(Tier);
+
+    // Most Paper actors don't tick at all (see APaperBase); only those running Event Tick need throttling
+    if (Actor->IsActorTickEnabled())
+    {
+        Actor->SetActorTickInterval(Settings.TickInterval);
+    }
+
+    // AI decisions run on the controller, so throttle it along with the pawn
+    if (AController* Controller = Actor->GetController())
+    {
+        Controller->SetActorTickInterval(Settings.TickInterval);
+    }
+
+    if (UPaperFlipbookComponent* Sprite = Actor->GetSprite())
+    {
+        const bool bAnimate = Settings.AnimationTickInterval >= 0.0f;
+        Sprite->SetComponentTickEnabled(bAnimate);
+        if (bAnimate)
+        {
+            Sprite->SetComponentTickInterval(Settings.AnimationTickInterval);
+        }
+    }
+
+    if (UCharacterMovementComponent* Movement = Actor->GetCharacterMovement())
+    {
+        Movement->SetComponentTickInterval(Settings.MovementTickInterval);
+    }
+
+    if (UCapsuleComponent* Capsule = Actor->GetCapsuleComponent())
+    {
+        Capsule->SetGenerateOverlapEvents(Settings.bGenerateOverlapEvents);
+    }
+}
@@ -0,0 +1,113 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SignificanceSubsystem.generated.h"
+
+class APaperBase;
+
+// How much per-frame work an actor is allowed; lower tiers tick, animate and move less often
+UENUM(BlueprintType)
+enum class ESignificanceTier : uint8
+{
+    High,
+    Medium,
+    Low,
+    Dormant,
+
+    Count UMETA(Hidden)
+};
+
+USTRUCT()
+struct FSignificanceTierSettings
+{
+    GENERATED_BODY()
+
+    // Actors further than this from the player drop to the next tier (ignored for Dormant)
+    UPROPERTY(EditAnywhere)
+    float MaxDistance = 0.0f;
+
+    // Actor and controller tick interval (0 = every frame)
+    UPROPERTY(EditAnywhere)
+    float TickInterval = 0.0f;
+
+    // Flipbook component tick interval; < 0 pauses the flipbook entirely
+    UPROPERTY(EditAnywhere)
+    float AnimationTickInterval = 0.0f;
+
+    // Movement component tick interval
+    UPROPERTY(EditAnywhere)
+    float MovementTickInterval = 0.0f;
+
+    // Whether the capsule keeps generating overlap events
+    UPROPERTY(EditAnywhere)
+    bool bGenerateOverlapEvents = true;
+};
+
+/**
+ * Scores every registered APaperBase by on-screen visibility and distance to the player and
+ * sorts it into a significance tier. Tier changes rewrite the actor's tick intervals, flipbook
+ * playback, movement update rate and overlap generation; nothing is touched while the tier holds.
+ * Promotions apply immediately, demotions need a widened distance band and a minimum time in tier
+ * so actors near a boundary don't flap. Tier populations are published under "stat Significance".
+ */
+UCLASS(Config = Game)
+class BRIDGEANDBLADE_API USignificanceSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    USignificanceSubsystem();
+
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    static USignificanceSubsystem* Get(const UObject* WorldContextObject);
+
+    // New actors start at High so nothing changes until they are first scored
+    void Register(APaperBase* Actor);
+    void Unregister(APaperBase* Actor);
+
+    ESignificanceTier GetTier(const APaperBase* Actor) const;
+
+    int32 GetNumActorsInTier(ESignificanceTier Tier) const { return TierCounts[(int32)Tier]; }
+
+    // Per-tier budgets, indexed by ESignificanceTier
+    UPROPERTY(Config, EditAnywhere, Category = "Significance")
+    TArray<FSignificanceTierSettings> TierSettings;
+
+    // Demotion needs the actor this much (fraction) past the tier's MaxDistance
+    UPROPERTY(Config, EditAnywhere, Category = "Significance")
+    float HysteresisFraction = 0.15f;
+
+    // Minimum seconds in a tier before it can be demoted
+    UPROPERTY(Config, EditAnywhere, Category = "Significance")
+    float MinTimeInTier = 0.5f;
+
+    // Seconds since last render that still count as on screen
+    UPROPERTY(Config, EditAnywhere, Category = "Significance")
+    float VisibilityGracePeriod = 0.25f;
+
+    // Actors re-scored per frame (round robin)
+    UPROPERTY(Config, EditAnywhere, Category = "Significance")
+    int32 MaxEvaluationsPerFrame = 48;
+
+private:
+    ESignificanceTier ScoreActor(const APaperBase* Actor, ESignificanceTier CurrentTier, float TimeInTier, const FVector& ViewerLocation) const;
+    void ApplyTier(APaperBase* Actor, ESignificanceTier Tier) const;
+    const FSignificanceTierSettings& GetSettings(ESignificanceTier Tier) const;
+
+    // Parallel per-actor arrays, indexed by APaperBase::SignificanceIndex
+    UPROPERTY(Transient)
+    TArray<TObjectPtr<APaperBase>> Actors;
+
+    TArray<ESignificanceTier> Tiers;
+    TArray<float> TierEnteredTimes;
+
+    int32 TierCounts[(int32)ESignificanceTier::Count] = {};
+    int32 EvaluationCursor = 0;
+};
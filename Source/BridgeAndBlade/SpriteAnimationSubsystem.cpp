@@ -0,0 +1,184 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SpriteAnimationSubsystem.h"
+#include "PaperBase.h"
+#include "PaperFlipbook.h"
+#include "PaperFlipbookComponent.h"
+#include "GameFramework/MovementComponent.h"
+#include "Engine/World.h"
+
+bool USpriteAnimationSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void USpriteAnimationSubsystem::Deinitialize()
+{
+    for (APaperBase* Owner : Owners)
+    {
+        if (Owner)
+        {
+            Owner->AnimationIndex = INDEX_NONE;
+        }
+    }
+
+    Owners.Empty();
+    Sprites.Empty();
+    Movements.Empty();
+    CurrentKeys.Empty();
+    Locked.Empty();
+
+    Super::Deinitialize();
+}
+
+TStatId USpriteAnimationSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(USpriteAnimationSubsystem, STATGROUP_Tickables);
+}
+
+USpriteAnimationSubsystem* USpriteAnimationSubsystem::Get(const UObject* WorldContextObject)
+{
+    UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    return World ? World->GetSubsystem<USpriteAnimationSubsystem>() : nullptr;
+}
+
+EPaperFacing USpriteAnimationSubsystem::ResolveFacing(const FVector& Direction)
+{
+    // Y axis is side to side, X axis is up and down
+    if (FMath::Abs(Direction.Y) > FMath::Abs(Direction.X))
+    {
+        return Direction.Y > 0 ? EPaperFacing::Right : EPaperFacing::Left;
+    }
+
+    return Direction.X > 0 ? EPaperFacing::Up : EPaperFacing::Down;
+}
+
+void USpriteAnimationSubsystem::Register(APaperBase* Actor)
+{
+    if (!Actor || Actor->AnimationIndex != INDEX_NONE || !Actor->GetSprite())
+        return;
+
+    Actor->AnimationIndex = Owners.Add(Actor);
+    Sprites.Add(Actor->GetSprite());
+    Movements.Add(Actor->GetMovementComponent());
+    CurrentKeys.Add(InvalidKey);
+    Locked.Add(false);
+}
+
+void USpriteAnimationSubsystem::Unregister(APaperBase* Actor)
+{
+    if (!Actor || !Owners.IsValidIndex(Actor->AnimationIndex) || Owners[Actor->AnimationIndex] != Actor)
+        return;
+
+    const int32 Index = Actor->AnimationIndex;
+    Actor->AnimationIndex = INDEX_NONE;
+
+    Owners.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    Sprites.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    Movements.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    CurrentKeys.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    Locked.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+
+    // The last entry moved into the freed slot
+    if (Owners.IsValidIndex(Index) && Owners[Index])
+    {
+        Owners[Index]->AnimationIndex = Index;
+    }
+}
+
+void USpriteAnimationSubsystem::SetAnimationLocked(APaperBase* Actor, bool bLocked)
+{
+    if (Actor && Locked.IsValidIndex(Actor->AnimationIndex))
+    {
+        Locked[Actor->AnimationIndex] = bLocked;
+    }
+}
+
+bool USpriteAnimationSubsystem::PlayDirectional(APaperBase* Actor, EPaperAnimState State, EPaperFacing Facing, bool bFromStart)
+{
+    if (!Actor || !Actor->GetSprite() || !Actor->GetDirectionalFlipbook(State, Facing))
+        return false;
+
+    if (CurrentKeys.IsValidIndex(Actor->AnimationIndex))
+    {
+        ApplyKey(Actor->AnimationIndex, MakeKey(State, Facing), bFromStart);
+        return true;
+    }
+
+    // Unregistered actors (e.g. during BeginPlay ordering) still get the flipbook
+    UPaperFlipbookComponent* Sprite = Actor->GetSprite();
+    if (Facing == EPaperFacing::Left || Facing == EPaperFacing::Right)
+    {
+        Sprite->SetRelativeScale3D(FVector(Facing == EPaperFacing::Left ? -1.f : 1.f, 1.f, 1.f));
+    }
+    Sprite->SetFlipbook(Actor->GetDirectionalFlipbook(State, Facing));
+    if (bFromStart)
+    {
+        Sprite->PlayFromStart();
+    }
+    return true;
+}
+
+void USpriteAnimationSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    const float MinSpeedSq = MinMoveSpeed * MinMoveSpeed;
+    const int32 Num = CurrentKeys.Num();
+
+    for (int32 i = 0; i < Num; ++i)
+    {
+        if (Locked[i])
+            continue;
+
+        const UMovementComponent* Movement = Movements[i];
+        if (!Movement)
+            continue;
+
+        // Standing still keeps whatever was last playing
+        const FVector Velocity = Movement->Velocity;
+        if (Velocity.SizeSquared() <= MinSpeedSq)
+            continue;
+
+        const uint8 Key = MakeKey(EPaperAnimState::Walk, ResolveFacing(Velocity));
+        if (Key != CurrentKeys[i])
+        {
+            ApplyKey(i, Key, false);
+        }
+    }
+}
+
+void USpriteAnimationSubsystem::ApplyKey(int32 Index, uint8 NewKey, bool bFromStart)
+{
+    APaperBase* Owner = Owners[Index];
+    UPaperFlipbookComponent* Sprite = Sprites[Index];
+    if (!Owner || !Sprite)
+        return;
+
+    const EPaperAnimState State = (EPaperAnimState)(NewKey >> 2);
+    const EPaperFacing Facing = (EPaperFacing)(NewKey & 0x3);
+
+    // Side animations share one flipbook and mirror it; up / down keep the last mirroring
+    if (Facing == EPaperFacing::Left || Facing == EPaperFacing::Right)
+    {
+        const float ScaleX = Facing == EPaperFacing::Left ? -1.f : 1.f;
+        if (Sprite->GetRelativeScale3D().X != ScaleX)
+        {
+            Sprite->SetRelativeScale3D(FVector(ScaleX, 1.f, 1.f));
+        }
+    }
+
+    UPaperFlipbook* Flipbook = Owner->GetDirectionalFlipbook(State, Facing);
+    if (Sprite->GetFlipbook() != Flipbook)
+    {
+        Sprite->SetFlipbook(Flipbook);
+    }
+
+    if (bFromStart)
+    {
+        Sprite->PlayFromStart();
+    }
+
+    CurrentKeys[Index] = NewKey;
+    Owner->bHasMoved |= State == EPaperAnimState::Walk;
+}
@@ -0,0 +1,90 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SpriteAnimationSubsystem.generated.h"
+
+class APaperBase;
+class UPaperFlipbook;
+class UPaperFlipbookComponent;
+class UMovementComponent;
+
+// Screen-space direction a Paper actor is facing, using the dominant axis of a world-space XY vector
+UENUM(BlueprintType)
+enum class EPaperFacing : uint8
+{
+    Up,
+    Down,
+    Left,
+    Right
+};
+
+// Which directional flipbook set to play
+UENUM(BlueprintType)
+enum class EPaperAnimState : uint8
+{
+    Walk,
+    Attack,
+    Windup,
+    Idle
+};
+
+/**
+ * Drives the directional flipbooks of every registered APaperBase.
+ * Each frame it quantizes velocity into a (state, facing) key per actor and only touches the
+ * flipbook component when that key changes. Per-actor data is kept in parallel arrays so the
+ * update is one tight loop; attack / wind-up selection goes through PlayDirectional.
+ */
+UCLASS()
+class BRIDGEANDBLADE_API USpriteAnimationSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    static USpriteAnimationSubsystem* Get(const UObject* WorldContextObject);
+
+    // Dominant-axis facing for a world-space direction (X = up / down, Y = right / left)
+    static EPaperFacing ResolveFacing(const FVector& Direction);
+
+    void Register(APaperBase* Actor);
+    void Unregister(APaperBase* Actor);
+
+    // Play Actor's flipbook for State / Facing. Returns false (and leaves the sprite alone) if that flipbook is not set.
+    bool PlayDirectional(APaperBase* Actor, EPaperAnimState State, EPaperFacing Facing, bool bFromStart = true);
+
+    // While locked, velocity changes do not switch the actor's flipbook
+    void SetAnimationLocked(APaperBase* Actor, bool bLocked);
+
+    // Below this speed the current flipbook is kept
+    static constexpr float MinMoveSpeed = 5.0f;
+
+private:
+    static constexpr uint8 InvalidKey = 0xFF;
+
+    static uint8 MakeKey(EPaperAnimState State, EPaperFacing Facing)
+    {
+        return (uint8)(((uint8)State << 2) | (uint8)Facing);
+    }
+
+    void ApplyKey(int32 Index, uint8 NewKey, bool bFromStart);
+
+    // Parallel per-actor arrays, indexed by APaperBase::AnimationIndex
+    UPROPERTY(Transient)
+    TArray<TObjectPtr<APaperBase>> Owners;
+
+    UPROPERTY(Transient)
+    TArray<TObjectPtr<UPaperFlipbookComponent>> Sprites;
+
+    UPROPERTY(Transient)
+    TArray<TObjectPtr<UMovementComponent>> Movements;
+
+    TArray<uint8> CurrentKeys;
+    TArray<bool> Locked;
+};
@@ -0,0 +1,300 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "TimerWheelSubsystem.h"
+#include "Engine/World.h"
+
+UTimerWheelSubsystem::UTimerWheelSubsystem()
+{
+    for (int32 Level = 0; Level < NumLevels; ++Level)
+    {
+        for (int32 Slot = 0; Slot < SlotsPerLevel; ++Slot)
+        {
+            SlotHeads[Level][Slot] = INDEX_NONE;
+        }
+    }
+}
+
+bool UTimerWheelSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UTimerWheelSubsystem::Deinitialize()
+{
+    Nodes.Empty();
+    FiringBatch.Empty();
+    FreeHead = INDEX_NONE;
+    NumActiveTimers = 0;
+
+    for (int32 Level = 0; Level < NumLevels; ++Level)
+    {
+        for (int32 Slot = 0; Slot < SlotsPerLevel; ++Slot)
+        {
+            SlotHeads[Level][Slot] = INDEX_NONE;
+        }
+    }
+
+    Super::Deinitialize();
+}
+
+TStatId UTimerWheelSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UTimerWheelSubsystem, STATGROUP_Tickables);
+}
+
+UTimerWheelSubsystem* UTimerWheelSubsystem::Get(const UObject* WorldContextObject)
+{
+    UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    return World ? World->GetSubsystem<UTimerWheelSubsystem>() : nullptr;
+}
+
+void UTimerWheelSubsystem::SetTimer(FWheelTimerHandle& InOutHandle, float Delay, FSimpleDelegate Callback)
+{
+    ClearTimer(InOutHandle);
+
+    const uint64 DelayTicks = (uint64)FMath::Max(1, FMath::CeilToInt(Delay * TicksPerSecond));
+
+    const int32 Index = AllocateNode();
+    FTimerNode& Node = Nodes[Index];
+    Node.Callback = MoveTemp(Callback);
+    Node.ExpireTick = CurrentTick + DelayTicks;
+    Node.State = ENodeState::Pending;
+    LinkNode(Index);
+
+    ++NumActiveTimers;
+
+    InOutHandle.Index = Index;
+    InOutHandle.Serial = Node.Serial;
+}
+
+void UTimerWheelSubsystem::ClearTimer(FWheelTimerHandle& InOutHandle)
+{
+    if (FTimerNode* Node = FindNode(InOutHandle))
+    {
+        // Nodes already in this frame's batch are just released; the batch skips stale serials
+        if (Node->State == ENodeState::Pending)
+        {
+            UnlinkNode(InOutHandle.Index);
+        }
+
+        FreeNode(InOutHandle.Index);
+        --NumActiveTimers;
+    }
+
+    InOutHandle.Invalidate();
+}
+
+bool UTimerWheelSubsystem::IsTimerActive(const FWheelTimerHandle& Handle) const
+{
+    return FindNode(Handle) != nullptr;
+}
+
+float UTimerWheelSubsystem::GetTimerRemaining(const FWheelTimerHandle& Handle) const
+{
+    const FTimerNode* Node = FindNode(Handle);
+    if (!Node)
+        return -1.0f;
+
+    // Signed: a node that is due (or firing this step) would wrap around as unsigned
+    const float TicksLeft = (float)((int64)Node->ExpireTick - (int64)CurrentTick) - PendingTicks;
+    return FMath::Max(0.0f, TicksLeft / TicksPerSecond);
+}
+
+void UTimerWheelSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    PendingTicks += DeltaTime * TicksPerSecond;
+    const int32 Steps = FMath::FloorToInt(PendingTicks);
+    if (Steps <= 0)
+        return;
+
+    PendingTicks -= Steps;
+
+    // Nothing scheduled: just move the clock
+    if (NumActiveTimers == 0)
+    {
+        CurrentTick += Steps;
+        return;
+    }
+
+    FiringBatch.Reset();
+    for (int32 Step = 0; Step < Steps; ++Step)
+    {
+        AdvanceOneTick();
+    }
+
+    // Fire the whole batch after the wheel has settled so callbacks can safely re-arm
+    for (int32 i = 0; i < FiringBatch.Num(); ++i)
+    {
+        const FFiringEntry Entry = FiringBatch[i];
+        if (!Nodes.IsValidIndex(Entry.Index))
+            continue;
+
+        FTimerNode& Node = Nodes[Entry.Index];
+        if (Node.State != ENodeState::Firing || Node.Serial != Entry.Serial)
+            continue;
+
+        FSimpleDelegate Callback = MoveTemp(Node.Callback);
+        FreeNode(Entry.Index);
+        --NumActiveTimers;
+
+        Callback.ExecuteIfBound();
+    }
+    FiringBatch.Reset();
+}
+
+void UTimerWheelSubsystem::AdvanceOneTick()
+{
+    ++CurrentTick;
+
+    // When a lower level wraps, pull the matching slot of the level above down into finer slots
+    for (int32 Level = 1; Level < NumLevels; ++Level)
+    {
+        const uint64 LowerBits = CurrentTick & ((uint64(1) << (SlotBits * Level)) - 1);
+        if (LowerBits != 0)
+            break;
+
+        CascadeSlot(Level, (int32)((CurrentTick >> (SlotBits * Level)) & (SlotsPerLevel - 1)));
+    }
+
+    const int32 Slot = (int32)(CurrentTick & (SlotsPerLevel - 1));
+    int32 Index = SlotHeads[0][Slot];
+    SlotHeads[0][Slot] = INDEX_NONE;
+
+    while (Index != INDEX_NONE)
+    {
+        FTimerNode& Node = Nodes[Index];
+        const int32 Next = Node.Next;
+
+        Node.Prev = INDEX_NONE;
+        Node.Next = INDEX_NONE;
+        Node.State = ENodeState::Firing;
+        FiringBatch.Add({ Index, Node.Serial });
+
+        Index = Next;
+    }
+}
+
+void UTimerWheelSubsystem::CascadeSlot(int32 Level, int32 Slot)
+{
+    int32 Index = SlotHeads[Level][Slot];
+    SlotHeads[Level][Slot] = INDEX_NONE;
+
+    while (Index != INDEX_NONE)
+    {
+        const int32 Next = Nodes[Index].Next;
+        Nodes[Index].Prev = INDEX_NONE;
+        Nodes[Index].Next = INDEX_NONE;
+        LinkNode(Index);
+        Index = Next;
+    }
+}
+
+void UTimerWheelSubsystem::LinkNode(int32 Index)
+{
+    FTimerNode& Node = Nodes[Index];
+
+    // Nodes cascaded down on the tick they expire land in the slot that is about to be collected
+    const uint64 Delta = Node.ExpireTick > CurrentTick ? Node.ExpireTick - CurrentTick : 0;
+
+    int32 Level = 0;
+    while (Level < NumLevels - 1 && Delta >= (uint64(1) << (SlotBits * (Level + 1))))
+    {
+        ++Level;
+    }
+
+    // Beyond the top level's range, park in the furthest slot and re-place on cascade
+    uint64 PlacementTick = FMath::Max(Node.ExpireTick, CurrentTick);
+    const uint64 MaxRange = uint64(1) << (SlotBits * NumLevels);
+    if (Delta >= MaxRange)
+    {
+        PlacementTick = CurrentTick + MaxRange - 1;
+    }
+
+    const int32 Slot = Delta == 0
+        ? (int32)(CurrentTick & (SlotsPerLevel - 1))
+        : (int32)((PlacementTick >> (SlotBits * Level)) & (SlotsPerLevel - 1));
+
+    Node.Level = (uint8)Level;
+    Node.Slot = (uint8)Slot;
+    Node.Prev = INDEX_NONE;
+    Node.Next = SlotHeads[Level][Slot];
+
+    if (Node.Next != INDEX_NONE)
+    {
+        Nodes[Node.Next].Prev = Index;
+    }
+    SlotHeads[Level][Slot] = Index;
+}
+
+void UTimerWheelSubsystem::UnlinkNode(int32 Index)
+{
+    FTimerNode& Node = Nodes[Index];
+
+    if (Node.Prev != INDEX_NONE)
+    {
+        Nodes[Node.Prev].Next = Node.Next;
+    }
+    else
+    {
+        SlotHeads[Node.Level][Node.Slot] = Node.Next;
+    }
+
+    if (Node.Next != INDEX_NONE)
+    {
+        Nodes[Node.Next].Prev = Node.Prev;
+    }
+
+    Node.Prev = INDEX_NONE;
+    Node.Next = INDEX_NONE;
+}
+
+int32 UTimerWheelSubsystem::AllocateNode()
+{
+    int32 Index = FreeHead;
+    if (Index != INDEX_NONE)
+    {
+        FreeHead = Nodes[Index].Next;
+    }
+    else
+    {
+        Index = Nodes.AddDefaulted();
+    }
+
+    FTimerNode& Node = Nodes[Index];
+    Node.Prev = INDEX_NONE;
+    Node.Next = INDEX_NONE;
+    Node.Serial = NextSerial++;
+    if (NextSerial == 0)
+    {
+        NextSerial = 1;
+    }
+
+    return Index;
+}
+
+void UTimerWheelSubsystem::FreeNode(int32 Index)
+{
+    FTimerNode& Node = Nodes[Index];
+    Node.Callback.Unbind();
+    Node.State = ENodeState::Free;
+    Node.Serial = 0;
+    Node.Prev = INDEX_NONE;
+    Node.Next = FreeHead;
+    FreeHead = Index;
+}
+
+UTimerWheelSubsystem::FTimerNode* UTimerWheelSubsystem::FindNode(const FWheelTimerHandle& Handle)
+{
+    if (!Handle.IsValid() || !Nodes.IsValidIndex(Handle.Index))
+        return nullptr;
+
+    FTimerNode& Node = Nodes[Handle.Index];
+    return (Node.State != ENodeState::Free && Node.Serial == Handle.Serial) ? &Node : nullptr;
+}
+
+const UTimerWheelSubsystem::FTimerNode* UTimerWheelSubsystem::FindNode(const FWheelTimerHandle& Handle) const
+{
+    return const_cast<UTimerWheelSubsystem*>(this)->FindNode(Handle);
+}
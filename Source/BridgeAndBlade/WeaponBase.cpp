@@ -11,8 +11,9 @@
 // Sets default values
 AWeaponBase::AWeaponBase()
 {
- 	// Set this actor to call Tick() every frame.  You can turn this off to improve performance if you don't need it.
+ 	// Only ticks while a swing / stab animation is playing
 	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bStartWithTickEnabled = false;
 
     // Create root scene component
     RootComponent = CreateDefaultSubobject<USceneComponent>(TEXT("RootComponent"));
@@ -133,6 +134,7 @@ void AWeaponBase::SwingAttack(AActor* Attacker)
     bIsAnimating = true;
     AnimationTimer = 0.0f;
     CurrentAnimationType = EAttackType::Swing;
+    SetActorTickEnabled(true);
 
     FVector StartLocation = AttackPoint->GetComponentLocation();
     FVector ForwardVector = Attacker->GetActorForwardVector();
@@ -188,6 +190,7 @@ void AWeaponBase::StabAttack(AActor* Attacker)
     bIsAnimating = true;
     AnimationTimer = 0.0f;
     CurrentAnimationType = EAttackType::Stab;
+    SetActorTickEnabled(true);
 
     FVector StartLocation = AttackPoint->GetComponentLocation();
     FVector ForwardVector = Attacker->GetActorForwardVector();
@@ -302,6 +305,7 @@ void AWeaponBase::ResetWeaponTransform()
     
     bIsAnimating = false;
     AnimationTimer = 0.0f;
+    SetActorTickEnabled(false);
 
     // Hide weapon after attack finishes
     SetWeaponVisible(false);